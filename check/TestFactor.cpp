@@ -1,5 +1,6 @@
 #include "Highs.h"
 #include "catch.hpp"
+#include "parallel/HighsParallel.h"
 #include "util/HFactor.h"
 
 const bool dev_run = false;
@@ -178,6 +179,118 @@ TEST_CASE("Factor-get-set-invert", "[highs_test_factor]") {
     REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
 }
 
+TEST_CASE("Factor-parallel-kernel", "[highs_test_factor]") {
+  // A random sparse matrix has a large kernel that fills in, so large
+  // pivots are eliminated in parallel. The factors must be the same as
+  // those formed serially
+  const HighsInt dim = 300;
+  HighsRandom random(11);
+  HighsSparseMatrix matrix;
+  matrix.num_col_ = dim;
+  matrix.num_row_ = dim;
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      if (iRow == iCol || random.fraction() < 0.05) {
+        matrix.index_.push_back(iRow);
+        matrix.value_.push_back(random.fraction() - 0.5);
+      }
+    }
+    matrix.start_.push_back(matrix.index_.size());
+  }
+  Highs::resetGlobalScheduler(true);
+  highs::parallel::initialize_scheduler(2);
+  std::vector<InvertibleRepresentation> invert;
+  std::vector<std::vector<double>> solve;
+  for (bool parallel_kernel : {false, true}) {
+    std::vector<HighsInt> basic_index(dim);
+    for (HighsInt iCol = 0; iCol < dim; iCol++) basic_index[iCol] = iCol;
+    HFactor kernel_factor;
+    kernel_factor.setup(matrix, basic_index);
+    kernel_factor.setUseParallelKernel(parallel_kernel);
+    REQUIRE(kernel_factor.build() == 0);
+    invert.push_back(kernel_factor.getInvert());
+    std::vector<double> x(dim, 1.0);
+    kernel_factor.ftranCall(x);
+    solve.push_back(x);
+  }
+  REQUIRE(invert[1].l_index == invert[0].l_index);
+  REQUIRE(invert[1].l_value == invert[0].l_value);
+  REQUIRE(invert[1].u_pivot_index == invert[0].u_pivot_index);
+  REQUIRE(invert[1].u_pivot_value == invert[0].u_pivot_value);
+  REQUIRE(invert[1].u_index == invert[0].u_index);
+  REQUIRE(invert[1].u_value == invert[0].u_value);
+  REQUIRE(solve[1] == solve[0]);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("Factor-dense-kernel", "[highs_test_factor]") {
+  // A random matrix that is mostly dense must be factored accurately
+  // with and without dense LU of the kernel, and its rank deficiency
+  // found when two columns are the same
+  const HighsInt dim = 150;
+  HighsRandom random(5);
+  for (bool singular : {false, true}) {
+    HighsSparseMatrix matrix;
+    matrix.num_col_ = dim;
+    matrix.num_row_ = dim;
+    for (HighsInt iCol = 0; iCol < dim; iCol++) {
+      if (singular && iCol == dim / 2) {
+        for (HighsInt iEl = matrix.start_[1]; iEl < matrix.start_[2]; iEl++) {
+          matrix.index_.push_back(matrix.index_[iEl]);
+          matrix.value_.push_back(matrix.value_[iEl]);
+        }
+      } else {
+        for (HighsInt iRow = 0; iRow < dim; iRow++) {
+          if (random.fraction() < 0.6) {
+            matrix.index_.push_back(iRow);
+            matrix.value_.push_back(random.fraction() - 0.5);
+          }
+        }
+      }
+      matrix.start_.push_back(matrix.index_.size());
+    }
+    std::vector<double> x_true(dim);
+    for (HighsInt iCol = 0; iCol < dim; iCol++)
+      x_true[iCol] = random.fraction() - 0.5;
+    for (bool dense_kernel : {false, true}) {
+      std::vector<HighsInt> basic_index(dim);
+      for (HighsInt iCol = 0; iCol < dim; iCol++) basic_index[iCol] = iCol;
+      HFactor dense_factor;
+      dense_factor.setup(matrix, basic_index);
+      dense_factor.setUseDenseKernel(dense_kernel);
+      const HighsInt rank_deficiency = dense_factor.build();
+      if (singular) {
+        REQUIRE(rank_deficiency == 1);
+        continue;
+      }
+      REQUIRE(rank_deficiency == 0);
+      // Solve B.x = b and B^T.y = c, where the entries of x and c are
+      // in the order of the permuted basic_index
+      std::vector<double> x(dim, 0);
+      std::vector<double> y(dim, 0);
+      for (HighsInt iRow = 0; iRow < dim; iRow++) {
+        const HighsInt iCol = basic_index[iRow];
+        for (HighsInt iEl = matrix.start_[iCol]; iEl < matrix.start_[iCol + 1];
+             iEl++) {
+          x[matrix.index_[iEl]] += matrix.value_[iEl] * x_true[iCol];
+          y[iRow] += matrix.value_[iEl] * x_true[matrix.index_[iEl]];
+        }
+      }
+      dense_factor.ftranCall(x);
+      dense_factor.btranCall(y);
+      double error = 0;
+      for (HighsInt iRow = 0; iRow < dim; iRow++) {
+        error =
+            std::max(error, std::fabs(x[iRow] - x_true[basic_index[iRow]]));
+        error = std::max(error, std::fabs(y[iRow] - x_true[iRow]));
+      }
+      if (dev_run)
+        printf("Dense kernel = %d: error = %g\n", (int)dense_kernel, error);
+      REQUIRE(error < 1e-8);
+    }
+  }
+}
+
 HighsInt rowOut(const HighsInt variable_out) {
   for (HighsInt iRow = 0; iRow < num_row; iRow++)
     if (basic_set[iRow] == variable_out) return iRow;
@@ -1,4 +1,6 @@
 #include <cstdio>
+#include <fstream>
+#include <sstream>
 
 #include "Highs.h"
 #include "catch.hpp"
@@ -119,6 +121,69 @@ TEST_CASE("filereader-free-format-parser", "[highs_filereader]") {
   REQUIRE(are_the_same);
 }
 
+TEST_CASE("filereader-mmap-mps", "[highs_filereader]") {
+  // The free format parser reads the memory-mapped file, and must give
+  // the same LP as the fixed format parser that reads it line by line
+  HighsStatus status;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string filename_free = "mmap-test-free.mps";
+  std::string filename_eof = "mmap-test-eof.mps";
+  for (std::string model : {"adlittle", "flugpl", "small_mip"}) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    status = highs.setOptionValue("mps_parser_type_free", false);
+    REQUIRE(status == HighsStatus::kOk);
+    status = highs.readModel(filename);
+    REQUIRE(status == HighsStatus::kOk);
+    HighsLp lp_fixed = highs.getLp();
+
+    status = highs.setOptionValue("mps_parser_type_free", true);
+    REQUIRE(status == HighsStatus::kOk);
+    status = highs.readModel(filename);
+    REQUIRE(status == HighsStatus::kOk);
+    HighsLp lp_free = highs.getLp();
+    bool are_the_same = lp_free == lp_fixed;
+    REQUIRE(are_the_same);
+
+    // Write the fields of each line separated by single spaces, so that
+    // they are no longer in the columns of the fixed format, and write a
+    // copy that does not end with a newline
+    std::ifstream in_file(filename);
+    std::ofstream free_file(filename_free);
+    std::string free_text;
+    std::string line;
+    while (std::getline(in_file, line)) {
+      std::istringstream fields(line);
+      std::string field;
+      std::string free_line;
+      while (fields >> field) {
+        if (!free_line.empty()) free_line += " ";
+        free_line += field;
+      }
+      // Keep the indentation that distinguishes data from section lines
+      if (!line.empty() && line[0] == ' ') free_line = " " + free_line;
+      free_text += free_line + "\n";
+    }
+    free_file << free_text;
+    free_file.close();
+    std::ofstream eof_file(filename_eof);
+    eof_file << free_text.substr(0, free_text.size() - 1);
+    eof_file.close();
+
+    for (std::string free_filename : {filename_free, filename_eof}) {
+      status = highs.readModel(free_filename);
+      REQUIRE(status == HighsStatus::kOk);
+      lp_free = highs.getLp();
+      lp_free.model_name_ = lp_fixed.model_name_;
+      are_the_same = lp_free == lp_fixed;
+      REQUIRE(are_the_same);
+    }
+  }
+  std::remove(filename_free.c_str());
+  std::remove(filename_eof.c_str());
+}
+
 // No commas in test case name.
 TEST_CASE("filereader-read-mps-ems-lp", "[highs_filereader]") {
   std::string filename;
@@ -232,3 +297,70 @@ TEST_CASE("filereader-fixed-integer", "[highs_filereader]") {
   objective_value = highs.getInfo().objective_function_value;
   REQUIRE(objective_value == optimal_objective_value);
 }
+
+TEST_CASE("filereader-hbin", "[highs_filereader]") {
+  HighsStatus status;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string filename_hbin = "hbin-test.hbin";
+
+  // Models with names, integrality and a Hessian round-trip exactly
+  for (std::string model : {"adlittle", "flugpl", "qjh"}) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    status = highs.readModel(filename);
+    REQUIRE(status == HighsStatus::kOk);
+    HighsModel model_mps = highs.getModel();
+    status = highs.writeModel(filename_hbin);
+    REQUIRE(status == HighsStatus::kOk);
+    status = highs.readModel(filename_hbin);
+    REQUIRE(status == HighsStatus::kOk);
+    HighsModel model_hbin = highs.getModel();
+    model_hbin.lp_.model_name_ = model_mps.lp_.model_name_;
+    bool are_the_same = model_hbin.lp_ == model_mps.lp_;
+    REQUIRE(are_the_same);
+    are_the_same = model_hbin.hessian_ == model_mps.hessian_;
+    REQUIRE(are_the_same);
+  }
+
+  // An optimal basis and solution are written with the model, so
+  // solving the model after reading it requires no iterations
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  status = highs.readModel(filename);
+  REQUIRE(status == HighsStatus::kOk);
+  status = highs.run();
+  REQUIRE(status == HighsStatus::kOk);
+  const double objective_function_value =
+      highs.getInfo().objective_function_value;
+  status = highs.writeModel(filename_hbin);
+  REQUIRE(status == HighsStatus::kOk);
+
+  Highs highs_hbin;
+  if (!dev_run) highs_hbin.setOptionValue("output_flag", false);
+  status = highs_hbin.readModel(filename_hbin);
+  REQUIRE(status == HighsStatus::kOk);
+  REQUIRE(highs_hbin.getBasis().valid);
+  REQUIRE(highs_hbin.getSolution().value_valid);
+  REQUIRE(highs_hbin.getSolution().dual_valid);
+  status = highs_hbin.run();
+  REQUIRE(status == HighsStatus::kOk);
+  REQUIRE(highs_hbin.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs_hbin.getInfo().simplex_iteration_count == 0);
+  REQUIRE(std::fabs(highs_hbin.getInfo().objective_function_value -
+                    objective_function_value) < 1e-8);
+
+  // A truncated file is rejected
+  std::vector<char> contents(1024);
+  FILE* file = fopen(filename_hbin.c_str(), "rb");
+  REQUIRE(file != nullptr);
+  const size_t size = fread(contents.data(), 1, contents.size(), file);
+  fclose(file);
+  file = fopen(filename_hbin.c_str(), "wb");
+  fwrite(contents.data(), 1, size / 2, file);
+  fclose(file);
+  status = highs_hbin.readModel(filename_hbin);
+  REQUIRE(status == HighsStatus::kError);
+
+  std::remove(filename_hbin.c_str());
+}
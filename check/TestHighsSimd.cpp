@@ -0,0 +1,166 @@
+#include <cstring>
+#include <vector>
+
+#include "Highs.h"
+#include "catch.hpp"
+#include "util/HighsRandom.h"
+#include "util/HighsSimd.h"
+
+const bool dev_run = false;
+
+using highs::simd::Isa;
+
+static bool bitIdentical(const std::vector<double>& v0,
+                         const std::vector<double>& v1) {
+  return v0.size() == v1.size() &&
+         std::memcmp(v0.data(), v1.data(), v0.size() * sizeof(double)) == 0;
+}
+
+TEST_CASE("HighsSimd-kernels", "[util]") {
+  // Random sparse matrix with columns of varying length, and a dense
+  // vector with entries that cancel, so that tiny values are formed
+  const HighsInt num_col = 203;
+  const HighsInt num_row = 97;
+  HighsRandom random(7);
+  std::vector<HighsInt> start{0};
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    HighsInt len = random.integer(iCol % 7 == 0 ? num_row : 12);
+    for (HighsInt iRow = random.integer(num_row - len + 1), k = 0; k < len;
+         k++, iRow++) {
+      index.push_back(iRow);
+      value.push_back(random.fraction() < 0.1 ? 1.0
+                                              : random.fraction() - 0.5);
+    }
+    start.push_back(index.size());
+  }
+  std::vector<double> x(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    x[iRow] = random.fraction() < 0.2 ? 0 : random.fraction() - 0.5;
+
+  const Isa supported_isa = highs::simd::supportedIsa();
+  std::vector<double> scalar_price;
+  std::vector<double> scalar_dense;
+  std::vector<double> scalar_sparse;
+  std::vector<HighsInt> scalar_sparse_index;
+  for (HighsInt isa = (HighsInt)Isa::kScalar; isa <= (HighsInt)supported_isa;
+       isa++) {
+    highs::simd::setActiveIsa(Isa(isa));
+    REQUIRE(highs::simd::activeIsa() == Isa(isa));
+
+    std::vector<double> price(num_col);
+    highs::simd::priceColumns(start.data(), index.data(), value.data(),
+                              x.data(), 0, num_col, price.data());
+
+    // Add multiples of the columns, treated as rows of the transpose
+    std::vector<double> dense(num_row);
+    std::vector<double> sparse(num_row);
+    std::vector<HighsInt> sparse_index(num_row);
+    HighsInt sparse_count = 0;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      double multiplier = x[iCol % num_row] + 1.0;
+      highs::simd::scatterAddDense(index.data(), value.data(), start[iCol],
+                                   start[iCol + 1], multiplier, dense.data());
+      if (iCol < 20)
+        sparse_count = highs::simd::scatterAddSparse(
+            index.data(), value.data(), start[iCol], start[iCol + 1],
+            multiplier, sparse.data(), sparse_index.data(), sparse_count);
+    }
+    sparse_index.resize(sparse_count);
+
+    if (isa == (HighsInt)Isa::kScalar) {
+      scalar_price = price;
+      scalar_dense = dense;
+      scalar_sparse = sparse;
+      scalar_sparse_index = sparse_index;
+    } else {
+      REQUIRE(bitIdentical(price, scalar_price));
+      REQUIRE(bitIdentical(dense, scalar_dense));
+      REQUIRE(bitIdentical(sparse, scalar_sparse));
+      REQUIRE(sparse_index == scalar_sparse_index);
+    }
+  }
+  highs::simd::setActiveIsa(supported_isa);
+}
+
+TEST_CASE("HighsSimd-edge-weights", "[util]") {
+  // Random pivotal column with zeros, and weights that some updates
+  // take below the minimum
+  const HighsInt num_row = 101;
+  const double min_weight = 1e-4;
+  HighsRandom random(11);
+  std::vector<double> column(num_row);
+  std::vector<double> dse(num_row);
+  std::vector<double> initial_weight(num_row);
+  std::vector<HighsInt> index;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    if (random.fraction() < 0.6) {
+      column[iRow] = random.fraction() - 0.5;
+      index.push_back(iRow);
+    }
+    dse[iRow] = 4 * random.fraction() - 2;
+    initial_weight[iRow] = random.fraction() + min_weight;
+  }
+  const double pivotal_weight = 1.7;
+  const double kai = -2 / 0.35;
+
+  const Isa supported_isa = highs::simd::supportedIsa();
+  std::vector<double> scalar_dense;
+  std::vector<double> scalar_sparse;
+  for (HighsInt isa = (HighsInt)Isa::kScalar; isa <= (HighsInt)supported_isa;
+       isa++) {
+    highs::simd::setActiveIsa(Isa(isa));
+    std::vector<double> dense = initial_weight;
+    highs::simd::updateEdgeWeights(nullptr, num_row, column.data(),
+                                   dse.data(), pivotal_weight, kai,
+                                   min_weight, dense.data());
+    std::vector<double> sparse = initial_weight;
+    highs::simd::updateEdgeWeights(index.data(), index.size(), column.data(),
+                                   dse.data(), pivotal_weight, kai,
+                                   min_weight, sparse.data());
+    if (isa == (HighsInt)Isa::kScalar) {
+      scalar_dense = dense;
+      scalar_sparse = sparse;
+      REQUIRE(bitIdentical(dense, sparse));
+      HighsInt num_min_weight = 0;
+      for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+        if (!column[iRow]) REQUIRE(dense[iRow] == initial_weight[iRow]);
+        if (dense[iRow] == min_weight) num_min_weight++;
+      }
+      REQUIRE(num_min_weight > 0);
+    } else {
+      REQUIRE(bitIdentical(dense, scalar_dense));
+      REQUIRE(bitIdentical(sparse, scalar_sparse));
+    }
+  }
+  highs::simd::setActiveIsa(supported_isa);
+}
+
+TEST_CASE("HighsSimd-simplex", "[util]") {
+  // The simplex solver must follow the same path with and without
+  // vectorised kernels
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  const Isa supported_isa = highs::simd::supportedIsa();
+  HighsInt scalar_iteration_count = -1;
+  double scalar_objective = 0;
+  for (Isa isa : {Isa::kScalar, supported_isa}) {
+    highs::simd::setActiveIsa(isa);
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    highs.setOptionValue("solver", kSimplexString);
+    highs.readModel(filename);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    if (isa == Isa::kScalar) {
+      scalar_iteration_count = highs.getInfo().simplex_iteration_count;
+      scalar_objective = highs.getInfo().objective_function_value;
+    } else {
+      REQUIRE(highs.getInfo().simplex_iteration_count ==
+              scalar_iteration_count);
+      REQUIRE(highs.getInfo().objective_function_value == scalar_objective);
+    }
+  }
+  highs::simd::setActiveIsa(supported_isa);
+}
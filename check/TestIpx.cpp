@@ -1,3 +1,4 @@
+#include "Highs.h"
 #include "catch.hpp"
 #include "ipm/ipx/ipx_status.h"
 #include "ipm/ipx/lp_solver.h"
@@ -80,3 +81,80 @@ TEST_CASE("test-ipx", "[highs_ipx]") {
 
   (void)(info);  // surpress unused variable.
 }
+
+TEST_CASE("test-ipx-parallel", "[highs_ipx]") {
+  // A transportation LP with enough nonzeros for IPX to compute products
+  // with the normal matrix using several threads
+  const HighsInt num_supply = 200;
+  const HighsInt num_demand = 260;
+  HighsLp lp;
+  lp.num_col_ = num_supply * num_demand;
+  lp.num_row_ = num_supply + num_demand;
+  lp.col_lower_.assign(lp.num_col_, 0);
+  lp.col_upper_.assign(lp.num_col_, kHighsInf);
+  lp.row_lower_.assign(num_supply, -kHighsInf);
+  lp.row_upper_.assign(num_supply, 130);
+  lp.row_lower_.resize(lp.num_row_, 100);
+  lp.row_upper_.resize(lp.num_row_, kHighsInf);
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  for (HighsInt iSupply = 0; iSupply < num_supply; iSupply++) {
+    for (HighsInt iDemand = 0; iDemand < num_demand; iDemand++) {
+      lp.col_cost_.push_back((37 * iSupply + 91 * iDemand) % 100 + 1);
+      lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+      lp.a_matrix_.index_.push_back(iSupply);
+      lp.a_matrix_.index_.push_back(num_supply + iDemand);
+      lp.a_matrix_.value_.push_back(1);
+      lp.a_matrix_.value_.push_back(1);
+    }
+  }
+  lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+
+  // The global scheduler has to be restarted to use more than one thread
+  Highs::resetGlobalScheduler(true);
+  highs.clearSolver();
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("solver", "ipm");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6 * optimal_objective);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("test-ipx-cholesky", "[highs_ipx]") {
+  // Solve with the sparse Cholesky KKT solver, serially and with two threads,
+  // and compare against the simplex solver
+  std::vector<std::string> model_names = {"afiro", "adlittle", "25fv47",
+                                          "shell"};
+  for (const std::string& model_name : model_names) {
+    const std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_name + ".mps";
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double optimal_objective = highs.getInfo().objective_function_value;
+    const double tolerance = 1e-6 * std::max(1.0, std::fabs(optimal_objective));
+
+    highs.setOptionValue("solver", "ipm");
+    highs.setOptionValue("ipm_kkt_solver", 1);
+    for (HighsInt threads = 1; threads <= 2; threads++) {
+      Highs::resetGlobalScheduler(true);
+      highs.clearSolver();
+      highs.setOptionValue("threads", threads);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                        optimal_objective) < tolerance);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
@@ -816,7 +816,8 @@ TEST_CASE("LP-modification", "[highs_data]") {
   callRun(highs, options.log_options, "highs.run()", HighsStatus::kOk);
 
   highs.getInfoValue("objective_function_value", optimal_objective_value);
-  REQUIRE(optimal_objective_value == avgas_optimal_objective_value);
+  REQUIRE(std::fabs(optimal_objective_value - avgas_optimal_objective_value) <
+          double_equal_tolerance);
 
   const HighsLp& local_lp = highs.getLp();
   row0135789_lower[0] = local_lp.row_lower_[0];
@@ -1447,6 +1448,132 @@ TEST_CASE("LP-free-row", "[highs_data]") {
   REQUIRE(highs.getInfo().objective_function_value == -3);
 }
 
+TEST_CASE("LP-add-cols-restart", "[highs_data]") {
+  // Column generation: batches of boxed copies of columns, with
+  // reduced costs, are added to the solved LP, which is then
+  // re-solved from the retained basis and INVERT
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("highs_debug_level", kHighsDebugLevelCostly);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const HighsInt original_num_col = highs.getNumCol();
+  const HighsInt num_nz = highs.getNumNz();
+  std::vector<double> cost(original_num_col);
+  std::vector<double> lower(original_num_col);
+  std::vector<double> upper(original_num_col);
+  std::vector<HighsInt> start(original_num_col);
+  std::vector<HighsInt> index(num_nz);
+  std::vector<double> value(num_nz);
+  const HighsInt batch_size = 20;
+  double objective_function_value =
+      highs.getInfo().objective_function_value;
+  for (HighsInt from_col = 0; from_col < original_num_col;
+       from_col += batch_size) {
+    const HighsInt to_col =
+        std::min(from_col + batch_size, original_num_col) - 1;
+    HighsInt num_col;
+    HighsInt num_col_nz;
+    highs.getCols(from_col, to_col, num_col, cost.data(), lower.data(),
+                  upper.data(), num_col_nz, start.data(), index.data(),
+                  value.data());
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      cost[iCol] -= 1;
+      lower[iCol] = 0;
+      upper[iCol] = 1;
+    }
+    REQUIRE(highs.addCols(num_col, cost.data(), lower.data(), upper.data(),
+                          num_col_nz, start.data(), index.data(),
+                          value.data()) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    // Adding columns can't worsen the optimal objective
+    REQUIRE(highs.getInfo().objective_function_value <=
+            objective_function_value + 1e-6);
+    objective_function_value = highs.getInfo().objective_function_value;
+  }
+  // Solving the final LP from scratch gives the same optimal
+  // objective
+  Highs fresh;
+  fresh.setOptionValue("output_flag", dev_run);
+  REQUIRE(fresh.passModel(highs.getLp()) == HighsStatus::kOk);
+  REQUIRE(fresh.run() == HighsStatus::kOk);
+  REQUIRE(fresh.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(fresh.getInfo().objective_function_value -
+                    objective_function_value) <=
+          1e-8 * std::max(1.0, std::fabs(objective_function_value)));
+}
+
+TEST_CASE("LP-add-rows-extend-invert", "[highs_data]") {
+  // Cutting plane loop: rounds of rows are added to the solved LP,
+  // each with a loose random row and a dense row that cuts off the
+  // optimal solution, and the LP is re-solved. The objective values
+  // must be the same whether the INVERT is extended or not
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  const HighsInt num_round = 5;
+  std::vector<double> objective_function_value[2];
+  for (HighsInt k = 0; k < 2; k++) {
+    const bool extend_invert = k == 1;
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("highs_debug_level", kHighsDebugLevelCostly);
+    highs.setOptionValue("extend_invert_when_adding_rows", extend_invert);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    const HighsLp& lp = highs.getLp();
+    const HighsInt num_col = lp.num_col_;
+    HighsRandom random(3);
+    for (HighsInt round = 0; round < num_round; round++) {
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      const std::vector<double>& col_value = highs.getSolution().col_value;
+      const double objective = highs.getInfo().objective_function_value;
+      objective_function_value[k].push_back(objective);
+      std::vector<double> lower;
+      std::vector<double> upper;
+      std::vector<HighsInt> start;
+      std::vector<HighsInt> index;
+      std::vector<double> value;
+      // Random row that is satisfied by the optimal solution
+      double activity = 0;
+      start.push_back(index.size());
+      for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+        if (random.fraction() > 0.1) continue;
+        index.push_back(iCol);
+        value.push_back(1);
+        activity += col_value[iCol];
+      }
+      lower.push_back(-kHighsInf);
+      upper.push_back(activity + 1);
+      // Row that requires the objective to increase
+      start.push_back(index.size());
+      for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+        if (!lp.col_cost_[iCol]) continue;
+        index.push_back(iCol);
+        value.push_back(lp.col_cost_[iCol]);
+      }
+      lower.push_back(objective - lp.offset_ +
+                      1e-3 * std::max(1.0, std::fabs(objective)));
+      upper.push_back(kHighsInf);
+      REQUIRE(highs.addRows(2, lower.data(), upper.data(), index.size(),
+                            start.data(), index.data(),
+                            value.data()) == HighsStatus::kOk);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+    }
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    objective_function_value[k].push_back(
+        highs.getInfo().objective_function_value);
+  }
+  for (HighsInt round = 0; round <= num_round; round++) {
+    const double objective = objective_function_value[0][round];
+    REQUIRE(std::fabs(objective_function_value[1][round] - objective) <=
+            1e-8 * std::max(1.0, std::fabs(objective)));
+  }
+}
+
 void HighsStatusReport(const HighsLogOptions& log_options, std::string message,
                        HighsStatus status) {
   if (!dev_run) return;
@@ -423,3 +423,121 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-10);
 }
+
+TEST_CASE("LP-concurrent", "[highs_lp_solver]") {
+  // The global scheduler has to be restarted to use more than one thread
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.setOptionValue("threads", 3) == HighsStatus::kOk);
+  REQUIRE(highs.setOptionValue("solver", "concurrent") == HighsStatus::kOk);
+
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = 5501.845888;
+  REQUIRE(std::fabs(info.objective_function_value - optimal_objective) <
+          1e-6 * optimal_objective);
+  REQUIRE(highs.getBasis().valid);
+
+  // With a basis the LP is re-solved using simplex
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(info.simplex_iteration_count == 0);
+
+  filename = std::string(HIGHS_DIR) + "/check/instances/woodinfe.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.setOptionValue("presolve", "off") == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("LP-parallel-solve", "[highs_lp_solver]") {
+  // Level scheduled solves with the basis factors must give the same
+  // results as the serial solves, so the simplex path is unchanged
+  Highs::resetGlobalScheduler(true);
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps";
+  HighsInt serial_iteration_count = -1;
+  double serial_objective = 0;
+  for (bool parallel_solve : {false, true}) {
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    const HighsInfo& info = highs.getInfo();
+    REQUIRE(highs.setOptionValue("threads", 2) == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("solver", "simplex") == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("simplex_parallel_solve", parallel_solve) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    if (!parallel_solve) {
+      serial_iteration_count = info.simplex_iteration_count;
+      serial_objective = info.objective_function_value;
+    } else {
+      REQUIRE(info.simplex_iteration_count == serial_iteration_count);
+      REQUIRE(info.objective_function_value == serial_objective);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("LP-parallel-chuzc", "[highs_lp_solver]") {
+  // The slices of the pivotal row are reduced and grouped in parallel
+  // by SIP, and the pivots must not depend on the number of threads
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps";
+  HighsInt serial_iteration_count = -1;
+  double serial_objective = 0;
+  for (HighsInt threads : {1, 2}) {
+    Highs::resetGlobalScheduler(true);
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    const HighsInfo& info = highs.getInfo();
+    REQUIRE(highs.setOptionValue("threads", threads) == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("solver", "simplex") == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("simplex_strategy",
+                                 kSimplexStrategyDualTasks) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    if (threads == 1) {
+      serial_iteration_count = info.simplex_iteration_count;
+      serial_objective = info.objective_function_value;
+    } else {
+      REQUIRE(info.simplex_iteration_count == serial_iteration_count);
+      REQUIRE(info.objective_function_value == serial_objective);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("LP-chuzr-heap", "[highs_lp_solver]") {
+  // Dual CHUZR using the max-heap of merits must give optimal
+  // solutions with each choice of dual edge weights
+  const std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  const double optimal_objective = 5501.845888;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.setOptionValue("solver", "simplex") == HighsStatus::kOk);
+  REQUIRE(highs.setOptionValue("dual_simplex_chuzr_heap", true) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  for (HighsInt strategy :
+       {kSimplexEdgeWeightStrategyDantzig, kSimplexEdgeWeightStrategyDevex,
+        kSimplexEdgeWeightStrategySteepestEdge}) {
+    REQUIRE(highs.setOptionValue("simplex_dual_edge_weight_strategy",
+                                 strategy) == HighsStatus::kOk);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(info.objective_function_value - optimal_objective) <
+            1e-6 * optimal_objective);
+  }
+}
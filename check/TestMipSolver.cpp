@@ -1,3 +1,5 @@
+#include <functional>
+
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
@@ -5,12 +7,23 @@
 const bool dev_run = false;
 const double double_equal_tolerance = 1e-5;
 
+std::string mip_log;
+static void mipLogCallback(HighsLogType type, const char* message,
+                           void* log_callback_data) {
+  if (dev_run) printf("%s", message);
+  mip_log += message;
+}
+
 void solve(Highs& highs, std::string presolve,
            const HighsModelStatus require_model_status,
            const double require_optimal_objective = 0,
            const double require_iteration_count = -1);
 void distillationMIP(Highs& highs);
 void rowlessMIP(Highs& highs);
+void requireSameSearch(
+    const std::string model, const double optimal_objective,
+    const std::vector<HighsInt>& threads,
+    const std::function<void(Highs&)>& set_options = nullptr);
 
 TEST_CASE("MIP-distillation", "[highs_test_mip_solver]") {
   Highs highs;
@@ -487,6 +500,187 @@ TEST_CASE("MIP-infeasible-start", "[highs_test_mip_solver]") {
   REQUIRE(model_status == HighsModelStatus::kInfeasible);
 }
 
+TEST_CASE("MIP-subtree-submips", "[highs_test_mip_solver]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double optimal_objective = 8966406.491519;
+
+  // The global scheduler has to be restarted to use more than one thread
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("mip_subtree_submips", true);
+  highs.setOptionValue("mip_rel_gap", 0.0);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6 * optimal_objective);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-subtree-submips-deterministic", "[highs_test_mip_solver]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double optimal_objective = 8966406.491519;
+
+  // The global scheduler has to be restarted to use more than one thread
+  Highs::resetGlobalScheduler(true);
+  std::vector<double> first_col_value;
+  int64_t first_node_count = -1;
+  for (HighsInt k = 0; k < 2; k++) {
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    highs.readModel(filename);
+    highs.setOptionValue("threads", 2);
+    highs.setOptionValue("mip_subtree_submips", true);
+    highs.setOptionValue("mip_parallel_deterministic", true);
+    highs.setOptionValue("mip_rel_gap", 0.0);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      optimal_objective) < 1e-6 * optimal_objective);
+    // Repeated runs give the same search and the same solution
+    if (k == 0) {
+      first_node_count = highs.getInfo().mip_node_count;
+      first_col_value = highs.getSolution().col_value;
+    } else {
+      REQUIRE(highs.getInfo().mip_node_count == first_node_count);
+      REQUIRE(highs.getSolution().col_value == first_col_value);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-background-heuristics", "[highs_test_mip_solver]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double optimal_objective = 8966406.491519;
+
+  // The global scheduler has to be restarted to use more than one thread
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  // The log is kept to count the sub-MIPs solved in the background
+  mip_log.clear();
+  highs.setLogCallback(mipLogCallback);
+  highs.readModel(filename);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("mip_background_heuristics", true);
+  highs.setOptionValue("mip_rel_gap", 0.0);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6 * optimal_objective);
+  const std::string report = "Background MIPs";
+  const size_t report_pos = mip_log.find(report);
+  REQUIRE(report_pos != std::string::npos);
+  REQUIRE(std::stoi(mip_log.substr(report_pos + report.size())) > 0);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-lazy-propagation", "[highs_test_mip_solver]") {
+  // Propagating all rows lazily must not change the optimal objective
+  const std::vector<std::pair<std::string, double>> models = {
+      {"bell5", 8966406.491519}, {"flugpl", 1201500}, {"lseu", 1120}};
+  for (const auto& model : models) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model.first + ".mps";
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    highs.readModel(filename);
+    highs.setOptionValue("mip_lazy_propagation_row_length", 1);
+    highs.setOptionValue("mip_rel_gap", 0.0);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      model.second) < 1e-6 * model.second);
+  }
+}
+
+TEST_CASE("MIP-presolve-parallel-strengthening", "[highs_test_mip_solver]") {
+  // With several threads, presolve strengthens the coefficients of the
+  // inequalities of p0548 concurrently, but must give the same result
+  // as with one
+  requireSameSearch("p0548", 8691, {1, 2});
+}
+
+TEST_CASE("MIP-presolve-parallel-probing", "[highs_test_mip_solver]") {
+  // With several threads, presolve probes the binaries of p0548 ahead
+  // on copies of the global domain, so repeated runs with the same
+  // number of threads must give the same result
+  requireSameSearch("p0548", 8691, {4, 4});
+}
+
+TEST_CASE("MIP-cutpool-separation-parallel", "[highs_test_mip_solver]") {
+  // With no minimal cut pool size, the cuts of p0548 are evaluated in
+  // parallel during cut pool separation, but must give the same search
+  // with two threads as with one
+  requireSameSearch("p0548", 8691, {1, 2}, [](Highs& highs) {
+    highs.setOptionValue("mip_min_cutpool_rows_for_parallelism", 0);
+  });
+}
+
+TEST_CASE("MIP-clique-separation-parallel", "[highs_test_mip_solver]") {
+  // With no minimal clique table size and two threads, clique
+  // separation searches the subtrees of the Bron-Kerbosch recursion in
+  // parallel, so repeated runs must give the same result
+  requireSameSearch("p0548", 8691, {2, 2}, [](Highs& highs) {
+    highs.setOptionValue("mip_min_cliquetable_entries_for_parallelism", 0);
+  });
+}
+
+TEST_CASE("MIP-keep-search-data", "[highs_test_mip_solver]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/dcmulti.mps";
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  highs.setOptionValue("mip_keep_search_data", true);
+  highs.setOptionValue("mip_rel_gap", 0.0);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+  // Solve the modified model from scratch to get the objective that the
+  // warm-started solve has to reproduce
+  auto requireColdObjective = [&]() {
+    Highs cold;
+    if (!dev_run) cold.setOptionValue("output_flag", false);
+    cold.passModel(highs.getModel());
+    cold.setOptionValue("mip_rel_gap", 0.0);
+    REQUIRE(cold.run() == HighsStatus::kOk);
+    REQUIRE(cold.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double objective = cold.getInfo().objective_function_value;
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value - objective) <
+            1e-6 * std::max(1.0, std::fabs(objective)));
+  };
+
+  // Change the costs of the integer columns: the previous incumbent stays
+  // feasible and is used as MIP start
+  const HighsLp& lp = highs.getLp();
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (lp.integrality_[iCol] != HighsVarType::kInteger) continue;
+    highs.changeColCost(iCol, 1.5 * lp.col_cost_[iCol] + 1);
+  }
+  requireColdObjective();
+
+  // Fix an integer column away from its value in the incumbent, so that the
+  // incumbent is no longer feasible
+  const std::vector<double>& col_value = highs.getSolution().col_value;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (lp.integrality_[iCol] != HighsVarType::kInteger) continue;
+    const double value = std::round(col_value[iCol]);
+    if (value > lp.col_lower_[iCol]) {
+      highs.changeColBounds(iCol, value - 1, value - 1);
+      break;
+    }
+  }
+  requireColdObjective();
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective,
                  const bool dev_run = false) {
@@ -552,3 +746,39 @@ void rowlessMIP(Highs& highs) {
   solve(highs, "on", require_model_status, optimal_objective);
   solve(highs, "off", require_model_status, optimal_objective);
 }
+
+void requireSameSearch(const std::string model,
+                       const double optimal_objective,
+                       const std::vector<HighsInt>& threads,
+                       const std::function<void(Highs&)>& set_options) {
+  // Solve the model with each number of threads in turn, and require the
+  // optimal objective and the same node count and solution as the first
+  // run
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+  std::vector<double> first_col_value;
+  int64_t first_node_count = -1;
+  for (size_t run = 0; run < threads.size(); run++) {
+    // The global scheduler has to be restarted to change the number
+    // of threads
+    Highs::resetGlobalScheduler(true);
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    highs.setOptionValue("threads", threads[run]);
+    if (set_options) set_options(highs);
+    highs.readModel(filename);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      optimal_objective) <
+            1e-6 * std::max(1.0, std::fabs(optimal_objective)));
+    if (run == 0) {
+      first_node_count = highs.getInfo().mip_node_count;
+      first_col_value = highs.getSolution().col_value;
+    } else {
+      REQUIRE(highs.getInfo().mip_node_count == first_node_count);
+      REQUIRE(highs.getSolution().col_value == first_col_value);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
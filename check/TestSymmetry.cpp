@@ -0,0 +1,102 @@
+#include "Highs.h"
+#include "catch.hpp"
+#include "parallel/HighsParallel.h"
+#include "presolve/HighsSymmetry.h"
+
+const bool dev_run = false;
+
+// Bin packing model with distinct item weights and identical bins, so the
+// symmetry group permutes the bins. Each item has an orbit of assignment
+// columns, and the bin usage columns form one more orbit
+HighsLp binPackingLp(const HighsInt num_item, const HighsInt num_bin) {
+  HighsLp lp;
+  lp.num_col_ = num_item * num_bin + num_bin;
+  lp.num_row_ = num_item + num_bin;
+  lp.col_cost_.assign(lp.num_col_, 0.0);
+  lp.col_lower_.assign(lp.num_col_, 0.0);
+  lp.col_upper_.assign(lp.num_col_, 1.0);
+  lp.integrality_.assign(lp.num_col_, HighsVarType::kInteger);
+  lp.row_lower_.assign(num_item, 1.0);
+  lp.row_upper_.assign(num_item, 1.0);
+  lp.row_lower_.resize(lp.num_row_, -kHighsInf);
+  lp.row_upper_.resize(lp.num_row_, 0.0);
+  const double capacity = num_item;
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.num_col_ = lp.num_col_;
+  lp.a_matrix_.num_row_ = lp.num_row_;
+  lp.a_matrix_.start_.assign(1, 0);
+  // Column item * num_bin + bin assigns the item to the bin
+  for (HighsInt item = 0; item < num_item; item++) {
+    for (HighsInt bin = 0; bin < num_bin; bin++) {
+      lp.a_matrix_.index_.push_back(item);
+      lp.a_matrix_.value_.push_back(1.0);
+      lp.a_matrix_.index_.push_back(num_item + bin);
+      lp.a_matrix_.value_.push_back(1.0 + item);
+      lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+    }
+  }
+  // Column num_item * num_bin + bin uses the bin
+  for (HighsInt bin = 0; bin < num_bin; bin++) {
+    lp.col_cost_[num_item * num_bin + bin] = 1.0;
+    lp.a_matrix_.index_.push_back(num_item + bin);
+    lp.a_matrix_.value_.push_back(-capacity);
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+  }
+  return lp;
+}
+
+HighsSymmetries detectSymmetries(const HighsLp& lp) {
+  HighsSymmetries symmetries;
+  HighsSymmetryDetection symmetry_detection;
+  symmetry_detection.loadModelAsGraph(lp, 1e-9);
+  if (symmetry_detection.initializeDetection())
+    symmetry_detection.run(symmetries);
+  return symmetries;
+}
+
+TEST_CASE("Symmetry-bin-packing", "[highs_test_symmetry]") {
+  const HighsInt num_item = 10;
+  const HighsInt num_bin = 6;
+  HighsLp lp = binPackingLp(num_item, num_bin);
+  Highs::resetGlobalScheduler(true);
+  highs::parallel::initialize_scheduler(1);
+  HighsSymmetries symmetries = detectSymmetries(lp);
+  if (dev_run)
+    printf("Symmetry-bin-packing: %d generators, %d orbitopes\n",
+           (int)symmetries.numGenerators, (int)symmetries.orbitopes.size());
+  // The bins are permuted by a symmetric group that needs num_bin - 1
+  // generators. It is handled as one full orbitope, whose rows are the
+  // orbits of the columns and whose columns are the bins
+  REQUIRE(symmetries.numGenerators == num_bin - 1);
+  REQUIRE(symmetries.orbitopes.size() == 1);
+  REQUIRE(symmetries.orbitopes[0].numRows == num_item + 1);
+  REQUIRE(symmetries.orbitopes[0].rowLength == num_bin);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("Symmetry-parallel-graph-comparison", "[highs_test_symmetry]") {
+  // With at least 5000 columns and more than one thread, the graphs of
+  // the leaves of the search are compared in parallel. The search tree
+  // is explored serially, so the same symmetries must be detected as
+  // with one thread
+  const HighsInt num_item = 100;
+  const HighsInt num_bin = 50;
+  HighsLp lp = binPackingLp(num_item, num_bin);
+  REQUIRE(lp.num_col_ >= 5000);
+  std::vector<HighsSymmetries> symmetries;
+  for (HighsInt threads = 1; threads <= 2; threads++) {
+    Highs::resetGlobalScheduler(true);
+    highs::parallel::initialize_scheduler(threads);
+    symmetries.push_back(detectSymmetries(lp));
+  }
+  REQUIRE(symmetries[0].numGenerators == num_bin - 1);
+  REQUIRE(symmetries[0].orbitopes.size() == 1);
+  REQUIRE(symmetries[0].orbitopes[0].numRows == num_item + 1);
+  REQUIRE(symmetries[1].numGenerators == symmetries[0].numGenerators);
+  REQUIRE(symmetries[1].numPerms == symmetries[0].numPerms);
+  REQUIRE(symmetries[1].permutations == symmetries[0].permutations);
+  REQUIRE(symmetries[1].orbitopes.size() == 1);
+  REQUIRE(symmetries[1].orbitopes[0].matrix ==
+          symmetries[0].orbitopes[0].matrix);
+  Highs::resetGlobalScheduler(true);
+}
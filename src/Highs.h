@@ -21,6 +21,7 @@
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsRanging.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "mip/HighsMipWarmStart.h"
 #include "model/HighsModel.h"
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
@@ -65,7 +66,8 @@ class Highs {
   HighsStatus clearModel();
 
   /**
-   * @brief Clear all solution data associated with the model
+   * @brief Clear all solution data associated with the model, including any
+   * search data kept for warm-starting the MIP solver
    */
   HighsStatus clearSolver();
 
@@ -1120,6 +1122,9 @@ class Highs {
 
   HEkk ekk_instance_;
 
+  // Search data kept between MIP solves when mip_keep_search_data is set
+  HighsMipWarmStart mip_warm_start_;
+
   HighsPresolveLog presolve_log_;
 
   HighsInt max_threads = 0;
@@ -612,7 +612,13 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("simplex_update_limit", &HighsOptions::simplex_update_limit)
     .def_readwrite("simplex_min_concurrency", &HighsOptions::simplex_min_concurrency)
     .def_readwrite("simplex_max_concurrency", &HighsOptions::simplex_max_concurrency)
+    .def_readwrite("simplex_parallel_solve", &HighsOptions::simplex_parallel_solve)
+    .def_readwrite("simplex_parallel_factor", &HighsOptions::simplex_parallel_factor)
+    .def_readwrite("factor_dense_kernel", &HighsOptions::factor_dense_kernel)
+    .def_readwrite("extend_invert_when_adding_rows", &HighsOptions::extend_invert_when_adding_rows)
+    .def_readwrite("dual_simplex_chuzr_heap", &HighsOptions::dual_simplex_chuzr_heap)
     .def_readwrite("ipm_iteration_limit", &HighsOptions::ipm_iteration_limit)
+    .def_readwrite("ipm_kkt_solver", &HighsOptions::ipm_kkt_solver)
     .def_readwrite("write_model_file", &HighsOptions::write_model_file)
     .def_readwrite("solution_file", &HighsOptions::solution_file)
     .def_readwrite("log_file", &HighsOptions::log_file)
@@ -628,6 +634,10 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("simplex_permute_strategy", &HighsOptions::simplex_permute_strategy)
     .def_readwrite("simplex_price_strategy", &HighsOptions::simplex_price_strategy)
     .def_readwrite("mip_detect_symmetry", &HighsOptions::mip_detect_symmetry)
+    .def_readwrite("mip_subtree_submips", &HighsOptions::mip_subtree_submips)
+    .def_readwrite("mip_parallel_deterministic", &HighsOptions::mip_parallel_deterministic)
+    .def_readwrite("mip_background_heuristics", &HighsOptions::mip_background_heuristics)
+    .def_readwrite("mip_keep_search_data", &HighsOptions::mip_keep_search_data)
     .def_readwrite("mip_max_nodes", &HighsOptions::mip_max_nodes)
     .def_readwrite("mip_max_stall_nodes", &HighsOptions::mip_max_stall_nodes)
     .def_readwrite("mip_max_leaves", &HighsOptions::mip_max_leaves)
@@ -637,6 +647,8 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("mip_pool_soft_limit", &HighsOptions::mip_pool_soft_limit)
     .def_readwrite("mip_pscost_minreliable", &HighsOptions::mip_pscost_minreliable)
     .def_readwrite("mip_min_cliquetable_entries_for_parallelism", &HighsOptions::mip_min_cliquetable_entries_for_parallelism)
+    .def_readwrite("mip_min_cutpool_rows_for_parallelism", &HighsOptions::mip_min_cutpool_rows_for_parallelism)
+    .def_readwrite("mip_lazy_propagation_row_length", &HighsOptions::mip_lazy_propagation_row_length)
     .def_readwrite("mip_report_level", &HighsOptions::mip_report_level)
     .def_readwrite("mip_feasibility_tolerance", &HighsOptions::mip_feasibility_tolerance)
     .def_readwrite("mip_rel_gap", &HighsOptions::mip_rel_gap)
@@ -14,6 +14,7 @@
 #include "io/Filereader.h"
 
 #include "io/FilereaderEms.h"
+#include "io/FilereaderHbin.h"
 #include "io/FilereaderLp.h"
 #include "io/FilereaderMps.h"
 #include "io/HighsIO.h"
@@ -50,6 +51,8 @@ Filereader* Filereader::getFilereader(const HighsLogOptions& log_options,
     reader = new FilereaderLp();
   } else if (extension.compare("ems") == 0) {
     reader = new FilereaderEms();
+  } else if (extension.compare("hbin") == 0) {
+    reader = new FilereaderHbin();
   } else {
     reader = NULL;
   }
@@ -0,0 +1,379 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbin.cpp
+ * @brief
+ */
+
+#include "io/FilereaderHbin.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "io/HighsFileBuffer.h"
+#include "lp_data/HConst.h"
+
+namespace {
+
+const char kHbinMagic[8] = {'H', 'I', 'G', 'H', 'S', 'B', 'I', 'N'};
+const uint32_t kHbinByteOrder = 0x01020304;
+
+enum HbinSection : uint32_t {
+  kHbinIntegrality = 1,
+  kHbinColNames = 2,
+  kHbinRowNames = 4,
+  kHbinHessian = 8,
+  kHbinBasis = 16,
+  kHbinPrimal = 32,
+  kHbinDual = 64,
+};
+
+struct HbinHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t int_size;
+  uint32_t sections;
+  int64_t num_col;
+  int64_t num_row;
+  int64_t num_nz;
+  int64_t hessian_dim;
+  int64_t hessian_nz;
+  int32_t sense;
+  int32_t hessian_format;
+  double offset;
+};
+
+size_t paddedSize(const size_t size) { return (size + 7) & ~(size_t)7; }
+
+class HbinWriter {
+ public:
+  explicit HbinWriter(FILE* file) : file_(file) {}
+  bool ok() const { return ok_; }
+
+  void write(const void* data, const size_t size) {
+    static const char kZero[8] = {0};
+    if (!ok_) return;
+    if (size && fwrite(data, 1, size, file_) != size) ok_ = false;
+    const size_t padding = paddedSize(size) - size;
+    if (padding && fwrite(kZero, 1, padding, file_) != padding) ok_ = false;
+  }
+
+  template <typename T>
+  void write(const std::vector<T>& values, const size_t count) {
+    assert(values.size() >= count);
+    write(values.data(), count * sizeof(T));
+  }
+
+ private:
+  FILE* file_;
+  bool ok_ = true;
+};
+
+// Reads arrays from the file contents, checking that they lie within them
+class HbinReader {
+ public:
+  HbinReader(const char* data, const size_t size) : data_(data), size_(size) {}
+
+  const char* read(const size_t size) {
+    if (size > size_ - pos_) return nullptr;
+    const char* data = data_ + pos_;
+    pos_ = std::min(size_, pos_ + paddedSize(size));
+    return data;
+  }
+
+  template <typename T>
+  bool read(std::vector<T>& values, const size_t count) {
+    if (count > (size_ - pos_) / sizeof(T)) return false;
+    const char* data = read(count * sizeof(T));
+    if (!data) return false;
+    values.resize(count);
+    if (count) memcpy(values.data(), data, count * sizeof(T));
+    return true;
+  }
+
+  // Reads indices that were written with int_size bytes each
+  bool readIndex(std::vector<HighsInt>& values, const size_t count,
+                 const uint32_t int_size) {
+    if (int_size == sizeof(HighsInt)) return read(values, count);
+    if (int_size == sizeof(int32_t)) {
+      std::vector<int32_t> file_values;
+      if (!read(file_values, count)) return false;
+      values.assign(file_values.begin(), file_values.end());
+      return true;
+    }
+    assert(int_size == sizeof(int64_t));
+    std::vector<int64_t> file_values;
+    if (!read(file_values, count)) return false;
+    values.resize(count);
+    for (size_t i = 0; i < count; i++) {
+      if (file_values[i] > kHighsIInf) return false;
+      values[i] = file_values[i];
+    }
+    return true;
+  }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t pos_ = 0;
+};
+
+bool readNames(const char*& names, const char* names_end, const size_t count,
+               std::vector<std::string>& name) {
+  name.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    const char* end = (const char*)memchr(names, '\0', names_end - names);
+    if (!end) return false;
+    name[i].assign(names, end);
+    names = end + 1;
+  }
+  return true;
+}
+
+void appendNames(const std::vector<std::string>& name, std::string& names) {
+  for (const std::string& n : name) {
+    names += n;
+    names += '\0';
+  }
+}
+
+}  // namespace
+
+FilereaderRetcode FilereaderHbin::readModelFromFile(const HighsOptions& options,
+                                                    const std::string filename,
+                                                    HighsModel& model) {
+  HighsFileBuffer file;
+  if (!file.open(filename)) return FilereaderRetcode::kFileNotFound;
+  HbinReader reader(file.data(), file.size());
+  auto parserError = [&](const char* message) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error in .hbin file %s: %s\n", filename.c_str(), message);
+    return FilereaderRetcode::kParserError;
+  };
+
+  HbinHeader header;
+  const char* header_data = reader.read(sizeof(HbinHeader));
+  if (!header_data) return parserError("incomplete header");
+  memcpy(&header, header_data, sizeof(HbinHeader));
+  if (memcmp(header.magic, kHbinMagic, sizeof(kHbinMagic)))
+    return parserError("not a HiGHS binary model file");
+  if (header.byte_order != kHbinByteOrder)
+    return parserError("written on a machine with different byte order");
+  if (header.version > kHbinVersion)
+    return parserError("written by a newer version of HiGHS");
+  if (header.int_size != sizeof(int32_t) && header.int_size != sizeof(int64_t))
+    return parserError("invalid integer size");
+  if (header.num_col < 0 || header.num_col >= kHighsIInf ||
+      header.num_row < 0 || header.num_row >= kHighsIInf ||
+      header.num_nz < 0 || header.num_nz > kHighsIInf ||
+      header.hessian_dim < 0 || header.hessian_dim >= kHighsIInf ||
+      header.hessian_nz < 0 || header.hessian_nz > kHighsIInf)
+    return parserError("invalid dimensions");
+  const uint32_t sections = header.sections;
+  const size_t num_col = header.num_col;
+  const size_t num_row = header.num_row;
+  const size_t num_nz = header.num_nz;
+
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.sense_ = header.sense == (int32_t)ObjSense::kMaximize ? ObjSense::kMaximize
+                                                           : ObjSense::kMinimize;
+  lp.offset_ = header.offset;
+  HighsSparseMatrix& matrix = lp.a_matrix_;
+  matrix.format_ = MatrixFormat::kColwise;
+  if (!reader.read(lp.col_cost_, num_col) ||
+      !reader.read(lp.col_lower_, num_col) ||
+      !reader.read(lp.col_upper_, num_col) ||
+      !reader.read(lp.row_lower_, num_row) ||
+      !reader.read(lp.row_upper_, num_row) ||
+      !reader.readIndex(matrix.start_, num_col + 1, header.int_size) ||
+      !reader.readIndex(matrix.index_, num_nz, header.int_size) ||
+      !reader.read(matrix.value_, num_nz))
+    return parserError("incomplete LP data");
+  if (matrix.start_[0] != 0 || matrix.start_[num_col] != (HighsInt)num_nz)
+    return parserError("inconsistent matrix starts");
+  lp.setMatrixDimensions();
+
+  if (sections & kHbinIntegrality) {
+    if (!reader.read(lp.integrality_, num_col))
+      return parserError("incomplete integrality data");
+    for (const HighsVarType type : lp.integrality_)
+      if (type > HighsVarType::kImplicitInteger)
+        return parserError("invalid integrality");
+  }
+
+  if (sections & kHbinHessian) {
+    HighsHessian& hessian = model.hessian_;
+    const size_t dim = header.hessian_dim;
+    hessian.dim_ = dim;
+    hessian.format_ = (HessianFormat)header.hessian_format;
+    if (!hessian.formatOk()) return parserError("invalid Hessian format");
+    if (!reader.readIndex(hessian.start_, dim + 1, header.int_size) ||
+        !reader.readIndex(hessian.index_, header.hessian_nz,
+                          header.int_size) ||
+        !reader.read(hessian.value_, header.hessian_nz))
+      return parserError("incomplete Hessian data");
+  }
+
+  if (sections & (kHbinColNames | kHbinRowNames)) {
+    std::vector<int64_t> names_size;
+    if (!reader.read(names_size, 1) || names_size[0] < 0)
+      return parserError("incomplete names");
+    const char* names = reader.read(names_size[0]);
+    if (!names) return parserError("incomplete names");
+    const char* names_end = names + names_size[0];
+    std::vector<std::string> objective_name;
+    if (!readNames(names, names_end, 1, objective_name) ||
+        ((sections & kHbinColNames) &&
+         !readNames(names, names_end, num_col, lp.col_names_)) ||
+        ((sections & kHbinRowNames) &&
+         !readNames(names, names_end, num_row, lp.row_names_)))
+      return parserError("incomplete names");
+    lp.objective_name_ = objective_name[0];
+  }
+
+  basis.clear();
+  if (sections & kHbinBasis) {
+    if (!reader.read(basis.col_status, num_col) ||
+        !reader.read(basis.row_status, num_row))
+      return parserError("incomplete basis");
+    for (const HighsBasisStatus status : basis.col_status)
+      if (status > HighsBasisStatus::kNonbasic)
+        return parserError("invalid basis status");
+    for (const HighsBasisStatus status : basis.row_status)
+      if (status > HighsBasisStatus::kNonbasic)
+        return parserError("invalid basis status");
+    basis.valid = true;
+    basis.alien = false;
+    basis.was_alien = false;
+  }
+
+  solution.clear();
+  if (sections & kHbinPrimal) {
+    if (!reader.read(solution.col_value, num_col) ||
+        !reader.read(solution.row_value, num_row))
+      return parserError("incomplete primal solution");
+    solution.value_valid = true;
+  }
+  if (sections & kHbinDual) {
+    if (!reader.read(solution.col_dual, num_col) ||
+        !reader.read(solution.row_dual, num_row))
+      return parserError("incomplete dual solution");
+    solution.dual_valid = true;
+  }
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderHbin::writeModelToFile(const HighsOptions& options,
+                                             const std::string filename,
+                                             const HighsModel& model) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  assert(lp.a_matrix_.isColwise());
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt num_nz = lp.a_matrix_.numNz();
+
+  HbinHeader header;
+  memset(&header, 0, sizeof(HbinHeader));
+  memcpy(header.magic, kHbinMagic, sizeof(kHbinMagic));
+  header.version = kHbinVersion;
+  header.byte_order = kHbinByteOrder;
+  header.int_size = sizeof(HighsInt);
+  header.num_col = num_col;
+  header.num_row = num_row;
+  header.num_nz = num_nz;
+  header.sense = (int32_t)lp.sense_;
+  header.offset = lp.offset_;
+  uint32_t sections = 0;
+  if (num_col && (HighsInt)lp.integrality_.size() == num_col)
+    sections |= kHbinIntegrality;
+  if (hessian.dim_ > 0) {
+    sections |= kHbinHessian;
+    header.hessian_dim = hessian.dim_;
+    header.hessian_nz = hessian.numNz();
+    header.hessian_format = (int32_t)hessian.format_;
+  }
+  if (num_col && (HighsInt)lp.col_names_.size() == num_col)
+    sections |= kHbinColNames;
+  if (num_row && (HighsInt)lp.row_names_.size() == num_row)
+    sections |= kHbinRowNames;
+  const HighsBasis* basis = write_basis_;
+  if (basis && basis->valid &&
+      (HighsInt)basis->col_status.size() == num_col &&
+      (HighsInt)basis->row_status.size() == num_row)
+    sections |= kHbinBasis;
+  const HighsSolution* solution = write_solution_;
+  if (solution && solution->value_valid &&
+      (HighsInt)solution->col_value.size() == num_col &&
+      (HighsInt)solution->row_value.size() == num_row)
+    sections |= kHbinPrimal;
+  if (solution && solution->dual_valid &&
+      (HighsInt)solution->col_dual.size() == num_col &&
+      (HighsInt)solution->row_dual.size() == num_row)
+    sections |= kHbinDual;
+  header.sections = sections;
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  if (!file) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  HbinWriter writer(file);
+  writer.write(&header, sizeof(HbinHeader));
+  writer.write(lp.col_cost_, num_col);
+  writer.write(lp.col_lower_, num_col);
+  writer.write(lp.col_upper_, num_col);
+  writer.write(lp.row_lower_, num_row);
+  writer.write(lp.row_upper_, num_row);
+  writer.write(lp.a_matrix_.start_, num_col + 1);
+  writer.write(lp.a_matrix_.index_, num_nz);
+  writer.write(lp.a_matrix_.value_, num_nz);
+  if (sections & kHbinIntegrality) writer.write(lp.integrality_, num_col);
+  if (sections & kHbinHessian) {
+    writer.write(hessian.start_, hessian.dim_ + 1);
+    writer.write(hessian.index_, header.hessian_nz);
+    writer.write(hessian.value_, header.hessian_nz);
+  }
+  if (sections & (kHbinColNames | kHbinRowNames)) {
+    std::string names = lp.objective_name_;
+    names += '\0';
+    if (sections & kHbinColNames) appendNames(lp.col_names_, names);
+    if (sections & kHbinRowNames) appendNames(lp.row_names_, names);
+    const int64_t names_size = names.size();
+    writer.write(&names_size, sizeof(names_size));
+    writer.write(names.data(), names.size());
+  }
+  if (sections & kHbinBasis) {
+    writer.write(basis->col_status, num_col);
+    writer.write(basis->row_status, num_row);
+  }
+  if (sections & kHbinPrimal) {
+    writer.write(solution->col_value, num_col);
+    writer.write(solution->row_value, num_row);
+  }
+  if (sections & kHbinDual) {
+    writer.write(solution->col_dual, num_col);
+    writer.write(solution->row_dual, num_row);
+  }
+  const bool ok = writer.ok();
+  if (fclose(file) != 0 || !ok) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
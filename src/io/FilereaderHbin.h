@@ -0,0 +1,57 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbin.h
+ * @brief
+ */
+
+#ifndef IO_FILEREADER_HBIN_H_
+#define IO_FILEREADER_HBIN_H_
+
+#include "io/Filereader.h"
+#include "io/HighsIO.h"  // For messages.
+#include "lp_data/HStruct.h"
+
+// The .hbin format stores a HighsModel in binary, in the byte order
+// and number representation of the machine that writes it. A fixed
+// header is followed by the arrays of the LP, each written raw and
+// padded to a multiple of eight bytes so that it is aligned when the
+// file is memory mapped. Sections for integrality, names, the
+// Hessian, a basis and a solution are optional, and are indicated by
+// flags in the header.
+const uint32_t kHbinVersion = 1;
+
+class FilereaderHbin : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+
+  // Basis and solution to be written with the model, if not null
+  void setWarmStart(const HighsBasis* basis, const HighsSolution* solution) {
+    write_basis_ = basis;
+    write_solution_ = solution;
+  }
+
+  // Basis and solution read with the model, valid if the file has them
+  HighsBasis basis;
+  HighsSolution solution;
+
+ private:
+  const HighsBasis* write_basis_ = nullptr;
+  const HighsSolution* write_solution_ = nullptr;
+};
+
+#endif
@@ -15,10 +15,6 @@
 
 #include "lp_data/HighsModelUtils.h"
 
-#ifdef ZLIB_FOUND
-#include "zstr/zstr.hpp"
-#endif
-
 namespace free_format_parser {
 
 FreeFormatParserReturnCode HMpsFF::loadProblem(
@@ -131,35 +127,14 @@ FreeFormatParserReturnCode HMpsFF::loadProblem(
 }
 
 HighsInt HMpsFF::fillMatrix(const HighsLogOptions& log_options) {
-  HighsInt num_entries = entries.size();
-  if (num_entries != num_nz) return 1;
-
-  a_value.resize(num_nz);
-  a_index.resize(num_nz);
-  a_start.assign(num_col + 1, 0);
-  // Nothing to do if there are no entries in the matrix
-  if (!num_entries) return 0;
-
-  HighsInt newColIndex = std::get<0>(entries.at(0));
-
-  for (HighsInt k = 0; k < num_nz; k++) {
-    a_value.at(k) = std::get<2>(entries.at(k));
-    a_index.at(k) = std::get<1>(entries.at(k));
-
-    if (std::get<0>(entries.at(k)) != newColIndex) {
-      HighsInt nEmptyCols = std::get<0>(entries.at(k)) - newColIndex;
-      newColIndex = std::get<0>(entries.at(k));
-      if (newColIndex >= num_col) return 1;
-
-      a_start.at(newColIndex) = k;
-      for (HighsInt i = 1; i < nEmptyCols; i++) {
-        a_start.at(newColIndex - i) = k;
-      }
-    }
-  }
-
-  for (HighsInt col = newColIndex + 1; col <= num_col; col++)
-    a_start[col] = num_nz;
+  // The column-wise matrix is assembled directly while reading the
+  // COLUMNS section, so only the starts of any columns added after
+  // that section remain to be set
+  if ((HighsInt)a_index.size() != num_nz ||
+      (HighsInt)a_value.size() != num_nz ||
+      (HighsInt)a_start.size() > num_col)
+    return 1;
+  a_start.resize(num_col + 1, num_nz);
 
   for (HighsInt i = 0; i < num_col; i++) {
     if (a_start[i] > a_start[i + 1]) {
@@ -218,23 +193,16 @@ FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
 
   highsLogDev(log_options, HighsLogType::kInfo,
               "readMPS: Trying to open file %s\n", filename.c_str());
-#ifdef ZLIB_FOUND
-  zstr::ifstream f;
-  try {
-    f.open(filename.c_str(), std::ios::in);
-  } catch (const strict_fstream::Exception& e) {
-    highsLogDev(log_options, HighsLogType::kInfo, e.what());
-    return FreeFormatParserReturnCode::kFileNotFound;
-  }
-#else
-  std::ifstream f;
-  f.open(filename.c_str(), std::ios::in);
-#endif
+  HighsFileBuffer f;
+  f.open(filename);
   if (f.is_open()) {
     start_time = getWallTime();
     num_row = 0;
     num_col = 0;
     num_nz = 0;
+    a_start.clear();
+    a_index.clear();
+    a_value.clear();
     cost_row_location = -1;
     // Indicate that no duplicate rows or columns have been found
     has_duplicate_row_name_ = false;
@@ -449,9 +417,9 @@ HighsInt HMpsFF::getColIdx(const std::string& colname, const bool add_if_new) {
 }
 
 HMpsFF::Parsekey HMpsFF::parseDefault(const HighsLogOptions& log_options,
-                                      std::istream& file) {
+                                      HighsFileBuffer& file) {
   std::string strline, word;
-  if (getline(file, strline)) {
+  if (file.getline(strline)) {
     strline = trim(strline);
     if (strline.empty()) return HMpsFF::Parsekey::kComment;
     HighsInt s, e;
@@ -495,10 +463,10 @@ double getWallTime() {
 }
 
 HMpsFF::Parsekey HMpsFF::parseObjsense(const HighsLogOptions& log_options,
-                                       std::istream& file) {
+                                       HighsFileBuffer& file) {
   std::string strline, word;
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     if (is_empty(strline) || strline[0] == '*') continue;
 
     HighsInt start = 0;
@@ -526,7 +494,7 @@ HMpsFF::Parsekey HMpsFF::parseObjsense(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
-                                   std::istream& file) {
+                                   HighsFileBuffer& file) {
   std::string strline, word;
   bool hasobj = false;
   // Assign a default objective name
@@ -535,7 +503,7 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
   assert(num_row == 0);
   assert(row_lower.size() == 0);
   assert(row_upper.size() == 0);
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     if (is_empty(strline) || strline[0] == '*') continue;
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
@@ -643,11 +611,60 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
   return HMpsFF::Parsekey::kFail;
 }
 
+// Whitespace separating the fields of a line, as for trim()
+static inline bool isFieldSeparator(const char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+         c == '\f';
+}
+
+// Splits the characters [begin, end) at whitespace into at most
+// max_num_token tokens, returning the number of tokens found
+static HighsInt splitLine(const char* begin, const char* end,
+                          const HighsInt max_num_token,
+                          const char** token_begin, const char** token_end) {
+  HighsInt num_token = 0;
+  const char* p = begin;
+  while (num_token < max_num_token) {
+    while (p != end && isFieldSeparator(*p)) p++;
+    if (p == end) break;
+    token_begin[num_token] = p;
+    while (p != end && !isFieldSeparator(*p)) p++;
+    token_end[num_token++] = p;
+  }
+  return num_token;
+}
+
+static bool tokenIs(const char* begin, const char* end, const char* word) {
+  const size_t length = strlen(word);
+  return (size_t)(end - begin) == length && !memcmp(begin, word, length);
+}
+
+// Section keywords consist of at least three upper case letters
+static bool tokenMayBeKeyword(const char* begin, const char* end) {
+  if (end - begin < 3) return false;
+  for (const char* p = begin; p != end; p++)
+    if (*p < 'A' || *p > 'Z') return false;
+  return true;
+}
+
+static double tokenValue(const char* begin, const char* end) {
+  char value[64];
+  const size_t length = end - begin;
+  if (length >= sizeof(value)) return atof(std::string(begin, end).c_str());
+  memcpy(value, begin, length);
+  value[length] = '\0';
+  return atof(value);
+}
+
 typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
-                                            std::istream& file) {
+                                            HighsFileBuffer& file) {
+  // Since the COLUMNS section is usually the bulk of an MPS file,
+  // lines are split in place in the file buffer rather than being
+  // copied, and the column-wise matrix is assembled directly
   std::string colname = "";
+  std::string rowname;
   std::string strline, word;
-  HighsInt rowidx, start, end;
+  HighsInt start, end;
   bool integral_cols = false;
   assert(num_col == 0);
   // Define the scattered value vector, index vector and count
@@ -658,68 +675,109 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
   col_value.assign(num_row, 0);
   col_index.resize(num_row);
 
-  auto parseName = [&rowidx, this](std::string name) {
-    auto mit = rowname2idx.find(name);
-
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
-
-    if (rowidx >= 0)
-      this->num_nz++;
-    else
-      assert(-1 == rowidx || -2 == rowidx);
+  // Record the nonzeros in the current column
+  auto completeColumn = [&]() {
+    if (col_cost) {
+      coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
+      col_cost = 0;
+    }
+    for (HighsInt iEl = 0; iEl < col_count; iEl++) {
+      const HighsInt iRow = col_index[iEl];
+      assert(col_value[iRow]);
+      a_index.push_back(iRow);
+      a_value.push_back(col_value[iRow]);
+      col_value[iRow] = 0;
+    }
+    col_count = 0;
   };
 
-  while (getline(file, strline)) {
-    double current = getWallTime();
-    if (time_limit > 0 && current - start_time > time_limit)
-      return HMpsFF::Parsekey::kTimeout;
-
-    if (kAnyFirstNonBlankAsStarImpliesComment) {
-      trim(strline);
-      if (strline.size() == 0 || strline[0] == '*') continue;
-    } else {
-      if (strline.size() > 0) {
-        // Just look for comment character in column 1
-        if (strline[0] == '*') continue;
+  // Add the value in [value_begin, value_end) for the row rowname to
+  // the current column
+  auto addEntry = [&](const char* value_begin, const char* value_end) {
+    auto mit = rowname2idx.find(rowname);
+    if (mit == rowname2idx.end()) {
+      highsLogUser(
+          log_options, HighsLogType::kWarning,
+          "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
+          rowname.c_str());
+      return;
+    }
+    const double value = tokenValue(value_begin, value_end);
+    if (!value) return;
+    const HighsInt rowidx = mit->second;
+    if (rowidx >= 0) {
+      if (col_value[rowidx]) {
+        // Ignore duplicate entry
+        highsLogUser(log_options, HighsLogType::kWarning,
+                     "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
+                     colname.c_str(), rowname.c_str());
+      } else {
+        num_nz++;
+        col_value[rowidx] = value;
+        col_index[col_count++] = rowidx;
       }
-      trim(strline);
-      if (strline.size() == 0) continue;
+    } else if (rowidx == -1) {
+      // Ignore duplicate entry
+      if (col_cost) {
+        highsLogUser(log_options, HighsLogType::kWarning,
+                     "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
+                     colname.c_str(), objective_name.c_str());
+      } else {
+        col_cost = value;
+      }
+    } else {
+      assert(-2 == rowidx);
     }
+  };
 
-    HMpsFF::Parsekey key = checkFirstWord(strline, start, end, word);
+  const char* line_begin;
+  const char* line_end;
+  const HighsInt kMaxNumToken = 5;
+  const char* token_begin[kMaxNumToken];
+  const char* token_end[kMaxNumToken];
+  HighsInt num_line = 0;
+  while (file.nextLine(line_begin, line_end)) {
+    if ((++num_line & 1023) == 0) {
+      double current = getWallTime();
+      if (time_limit > 0 && current - start_time > time_limit)
+        return HMpsFF::Parsekey::kTimeout;
+    }
+
+    if (line_begin != line_end && line_begin[0] == '*') continue;
+    const HighsInt num_token = splitLine(line_begin, line_end, kMaxNumToken,
+                                         token_begin, token_end);
+    if (num_token == 0) continue;
+    if (kAnyFirstNonBlankAsStarImpliesComment && token_begin[0][0] == '*')
+      continue;
 
-    // start of new section?
-    if (key != Parsekey::kNone) {
-      if (num_col) {
-        if (col_cost) {
-          coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
-          col_cost = 0;
-        }
-        for (HighsInt iEl = 0; iEl < col_count; iEl++) {
-          const HighsInt iRow = col_index[iEl];
-          assert(col_value[iRow]);
-          entries.push_back(
-              std::make_tuple(num_col - 1, iRow, col_value[iRow]));
-          col_value[iRow] = 0;
-        }
-        col_count = 0;
+    if (tokenMayBeKeyword(token_begin[0], token_end[0])) {
+      strline.assign(token_begin[0], line_end);
+      trim(strline);
+      HMpsFF::Parsekey key = checkFirstWord(strline, start, end, word);
+
+      // start of new section?
+      if (key != Parsekey::kNone) {
+        if (num_col) completeColumn();
+        highsLogDev(log_options, HighsLogType::kInfo,
+                    "readMPS: Read COLUMNS OK\n");
+        return key;
       }
+    }
 
-      highsLogDev(log_options, HighsLogType::kInfo,
-                  "readMPS: Read COLUMNS OK\n");
-      return key;
+    if (num_token < 2) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "No row name given for column \"%s\"\n",
+                   std::string(token_begin[0], token_end[0]).c_str());
+      return HMpsFF::Parsekey::kFail;
     }
 
     // check for integrality marker
-    std::string marker = first_word(strline, end);
-    HighsInt end_marker = first_word_end(strline, end);
-
-    if (marker == "'MARKER'") {
-      marker = first_word(strline, end_marker);
-
-      if ((integral_cols && marker != "'INTEND'") ||
-          (!integral_cols && marker != "'INTORG'")) {
+    if (tokenIs(token_begin[1], token_end[1], "'MARKER'")) {
+      if (num_token < 3 ||
+          (integral_cols &&
+           !tokenIs(token_begin[2], token_end[2], "'INTEND'")) ||
+          (!integral_cols &&
+           !tokenIs(token_begin[2], token_end[2], "'INTORG'"))) {
         highsLogUser(
             log_options, HighsLogType::kError,
             "Integrality marker error in COLUMNS section of MPS file\n");
@@ -729,6 +787,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
 
       continue;
     }
+    rowname.assign(token_begin[1], token_end[1]);
     // Detect whether the file is in fixed format with spaces in
     // names, even if there are no known examples!
     //
@@ -742,11 +801,13 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
     // (pyomo.mps). Have to distinguish this from 8-character names
     // with spaces. Best bet is to see whether "marker" is in the set
     // of row names. If it is, then assume that the names are short
+    const HighsInt end_marker = token_end[1] - token_begin[0];
     if (end_marker < 9) {
-      auto mit = rowname2idx.find(marker);
+      auto mit = rowname2idx.find(rowname);
       if (mit == rowname2idx.end()) {
         // marker is not a row name, so continue to look at name
-        std::string name = strline.substr(0, 10);
+        std::string name(token_begin[0],
+                         std::min(line_end - token_begin[0], (ptrdiff_t)10));
         // Delete trailing spaces
         name = trim(name);
         if (name.size() > 8) {
@@ -766,24 +827,14 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
     }
 
     // Test for new column
-    if (!(word == colname)) {
+    const size_t colname_length = token_end[0] - token_begin[0];
+    if (colname.size() != colname_length ||
+        memcmp(colname.data(), token_begin[0], colname_length)) {
       // Record the nonzeros in any previous column
-      if (num_col) {
-        if (col_cost) {
-          coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
-          col_cost = 0;
-        }
-        for (HighsInt iEl = 0; iEl < col_count; iEl++) {
-          const HighsInt iRow = col_index[iEl];
-          assert(col_value[iRow]);
-          entries.push_back(
-              std::make_tuple(num_col - 1, iRow, col_value[iRow]));
-          col_value[iRow] = 0;
-        }
-        col_count = 0;
-      }
+      if (num_col) completeColumn();
       assert(!col_cost);
-      colname = word;
+      a_start.push_back(a_index.size());
+      colname.assign(token_begin[0], token_end[0]);
       auto ret = colname2idx.emplace(colname, num_col++);
       col_names.push_back(colname);
       if (!ret.second) {
@@ -813,103 +864,24 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
 
     assert(num_col > 0);
 
-    // here marker is the row name and end marks its end
-    word = "";
-    word = first_word(strline, end_marker);
-    end = first_word_end(strline, end_marker);
-
-    if (word == "") {
+    if (num_token < 3) {
       highsLogUser(log_options, HighsLogType::kError,
-                   "No coefficient given for column \"%s\"\n", marker.c_str());
+                   "No coefficient given for column \"%s\"\n",
+                   rowname.c_str());
       return HMpsFF::Parsekey::kFail;
     }
+    addEntry(token_begin[2], token_end[2]);
 
-    auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
-      highsLogUser(
-          log_options, HighsLogType::kWarning,
-          "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
-          marker.c_str());
-    } else {
-      double value = atof(word.c_str());
-      if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
-        if (rowidx >= 0) {
-          if (col_value[rowidx]) {
-            // Ignore duplicate entry
-            num_nz--;
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), marker.c_str());
-          } else {
-            col_value[rowidx] = value;
-            col_index[col_count++] = rowidx;
-          }
-        } else if (rowidx == -1) {
-          // Ignore duplicate entry
-          if (col_cost) {
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), objective_name.c_str());
-          } else {
-            col_cost = value;
-          }
-        }
-      }
-    }
-
-    if (!is_end(strline, end)) {
+    if (num_token > 3) {
       // parse second coefficient
-      marker = first_word(strline, end);
-      if (word == "") {
+      rowname.assign(token_begin[3], token_end[3]);
+      if (num_token < 5) {
         highsLogUser(log_options, HighsLogType::kError,
                      "No coefficient given for column \"%s\"\n",
-                     marker.c_str());
+                     rowname.c_str());
         return HMpsFF::Parsekey::kFail;
       }
-      end_marker = first_word_end(strline, end);
-
-      // here marker is the row name and end marks its end
-      word = "";
-      end_marker++;
-      word = first_word(strline, end_marker);
-      end = first_word_end(strline, end_marker);
-
-      assert(is_end(strline, end));
-
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
-        highsLogUser(
-            log_options, HighsLogType::kWarning,
-            "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
-            marker.c_str());
-        continue;
-      };
-      double value = atof(word.c_str());
-      if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
-        if (rowidx >= 0) {
-          if (col_value[rowidx]) {
-            // Ignore duplicate entry
-            num_nz--;
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), marker.c_str());
-          } else {
-            col_value[rowidx] = value;
-            col_index[col_count++] = rowidx;
-          }
-        } else if (rowidx == -1) {
-          // Ignore duplicate entry
-          if (col_cost) {
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), objective_name.c_str());
-          } else {
-            col_cost = value;
-          }
-        }
-      }
+      addEntry(token_begin[4], token_end[4]);
     }
   }
 
@@ -917,7 +889,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
-                                  std::istream& file) {
+                                  HighsFileBuffer& file) {
   std::string strline;
 
   auto parseName = [this](const std::string& name, HighsInt& rowidx,
@@ -963,7 +935,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
   has_obj_entry_ = false;
   bool has_entry = false;
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -1098,7 +1070,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
-                                     std::istream& file) {
+                                     HighsFileBuffer& file) {
   std::string strline, word;
 
   HighsInt num_mi = 0;
@@ -1114,7 +1086,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
   has_lower.assign(num_col, false);
   has_upper.assign(num_col, false);
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -1354,7 +1326,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
 }
 
 HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
-                                     std::istream& file) {
+                                     HighsFileBuffer& file) {
   std::string strline, word;
 
   auto parseName = [this](const std::string& name, HighsInt& rowidx) {
@@ -1382,7 +1354,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
   // Initialise tracking for duplicate entries
   has_row_entry_.assign(num_row, false);
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -1501,7 +1473,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
 }
 
 typename HMpsFF::Parsekey HMpsFF::parseHessian(
-    const HighsLogOptions& log_options, std::istream& file,
+    const HighsLogOptions& log_options, HighsFileBuffer& file,
     const HMpsFF::Parsekey keyword) {
   // Parse Hessian information from QUADOBJ or QMATRIX
   // section according to keyword
@@ -1520,7 +1492,7 @@ typename HMpsFF::Parsekey HMpsFF::parseHessian(
   HighsInt end_coeff_name;
   HighsInt colidx, rowidx;
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -1601,7 +1573,7 @@ typename HMpsFF::Parsekey HMpsFF::parseHessian(
 }
 
 typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
-    const HighsLogOptions& log_options, std::istream& file,
+    const HighsLogOptions& log_options, HighsFileBuffer& file,
     const HMpsFF::Parsekey keyword) {
   // Parse Hessian information from QSECTION or QCMATRIX
   // section according to keyword
@@ -1637,7 +1609,7 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
                    "Row name \"%s\" in %s section is not defined: ignored\n",
                    rowname.c_str(), section_name.c_str());
     // read lines until start of new section
-    while (getline(file, strline)) {
+    while (file.getline(strline)) {
       HighsInt begin = 0;
       HighsInt end = 0;
       HMpsFF::Parsekey key = checkFirstWord(strline, begin, end, col_name);
@@ -1660,7 +1632,7 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
 
   auto& qentries = (rowidx == -1 ? q_entries : qrows_entries[rowidx]);
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -1737,7 +1709,7 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
 }
 
 typename HMpsFF::Parsekey HMpsFF::parseCones(const HighsLogOptions& log_options,
-                                             std::istream& file) {
+                                             HighsFileBuffer& file) {
   HighsInt end = 0;
 
   // first argument should be cone name
@@ -1801,7 +1773,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCones(const HighsLogOptions& log_options,
 
   // now parse the cone entries: one column per line
   std::string strline;
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -1840,11 +1812,11 @@ typename HMpsFF::Parsekey HMpsFF::parseCones(const HighsLogOptions& log_options,
 }
 
 typename HMpsFF::Parsekey HMpsFF::parseSos(const HighsLogOptions& log_options,
-                                           std::istream& file,
+                                           HighsFileBuffer& file,
                                            const HMpsFF::Parsekey keyword) {
   std::string strline, word;
 
-  while (getline(file, strline)) {
+  while (file.getline(strline)) {
     double current = getWallTime();
     if (time_limit > 0 && current - start_time > time_limit)
       return HMpsFF::Parsekey::kTimeout;
@@ -33,6 +33,7 @@
 #include <utility>
 #include <vector>
 
+#include "io/HighsFileBuffer.h"
 #include "io/HighsIO.h"
 #include "model/HighsModel.h"
 // #include "util/HighsInt.h"
@@ -173,7 +174,6 @@ class HMpsFF {
   std::vector<Boundtype> row_type;
   std::vector<HighsInt> integer_column;
 
-  std::vector<Triplet> entries;
   std::vector<Triplet> q_entries;
   std::vector<std::vector<Triplet>> qrows_entries;
   std::vector<std::pair<HighsInt, double>> coeffobj;
@@ -202,29 +202,29 @@ class HMpsFF {
   HighsInt getColIdx(const std::string& colname, const bool add_if_new = true);
 
   HMpsFF::Parsekey parseDefault(const HighsLogOptions& log_options,
-                                std::istream& file);
+                                HighsFileBuffer& file);
   HMpsFF::Parsekey parseObjsense(const HighsLogOptions& log_options,
-                                 std::istream& file);
+                                 HighsFileBuffer& file);
   HMpsFF::Parsekey parseRows(const HighsLogOptions& log_options,
-                             std::istream& file);
+                             HighsFileBuffer& file);
   HMpsFF::Parsekey parseCols(const HighsLogOptions& log_options,
-                             std::istream& file);
+                             HighsFileBuffer& file);
   HMpsFF::Parsekey parseRhs(const HighsLogOptions& log_options,
-                            std::istream& file);
+                            HighsFileBuffer& file);
   HMpsFF::Parsekey parseRanges(const HighsLogOptions& log_options,
-                               std::istream& file);
+                               HighsFileBuffer& file);
   HMpsFF::Parsekey parseBounds(const HighsLogOptions& log_options,
-                               std::istream& file);
+                               HighsFileBuffer& file);
   HMpsFF::Parsekey parseHessian(const HighsLogOptions& log_options,
-                                std::istream& file,
+                                HighsFileBuffer& file,
                                 const HMpsFF::Parsekey keyword);
   HMpsFF::Parsekey parseQuadRows(const HighsLogOptions& log_options,
-                                 std::istream& file,
+                                 HighsFileBuffer& file,
                                  const HMpsFF::Parsekey keyword);
   HMpsFF::Parsekey parseCones(const HighsLogOptions& log_options,
-                              std::istream& file);
+                              HighsFileBuffer& file);
   HMpsFF::Parsekey parseSos(const HighsLogOptions& log_options,
-                            std::istream& file, const HMpsFF::Parsekey keyword);
+                            HighsFileBuffer& file, const HMpsFF::Parsekey keyword);
 
   bool cannotParseSection(const HighsLogOptions& log_options,
                           const HMpsFF::Parsekey keyword);
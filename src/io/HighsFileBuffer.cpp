@@ -0,0 +1,98 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsFileBuffer.cpp
+ * @brief
+ */
+#include "io/HighsFileBuffer.h"
+
+#include <fstream>
+
+#include "HConfig.h"
+
+#ifdef ZLIB_FOUND
+#include "zstr/zstr.hpp"
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool HighsFileBuffer::open(const std::string& filename) {
+  close();
+#ifndef _WIN32
+  // Map an uncompressed regular file into memory. Compressed files
+  // are recognised by the gzip magic number
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  unsigned char magic[2] = {0, 0};
+  const bool compressed =
+      ::read(fd, magic, 2) == 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+  struct stat file_stat;
+  if (!compressed && fstat(fd, &file_stat) == 0 &&
+      S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+    void* mapped =
+        mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped != MAP_FAILED) {
+      madvise(mapped, file_stat.st_size, MADV_SEQUENTIAL);
+      ::close(fd);
+      mapped_ = mapped;
+      data_ = (const char*)mapped;
+      size_ = file_stat.st_size;
+      open_ = true;
+      return true;
+    }
+  }
+  ::close(fd);
+#endif
+  // Otherwise read the whole (decompressed) file into memory
+#ifdef ZLIB_FOUND
+  zstr::ifstream file;
+  try {
+    file.open(filename.c_str(), std::ios::in);
+  } catch (const strict_fstream::Exception&) {
+    return false;
+  }
+#else
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+#endif
+  if (!file.is_open()) return false;
+  const size_t kChunkSize = 1 << 16;
+  size_t size = 0;
+  for (;;) {
+    buffer_.resize(size + kChunkSize);
+    file.read(buffer_.data() + size, kChunkSize);
+    const size_t count = file.gcount();
+    size += count;
+    if (count < kChunkSize) break;
+  }
+  buffer_.resize(size);
+  data_ = buffer_.data();
+  size_ = size;
+  open_ = true;
+  return true;
+}
+
+void HighsFileBuffer::close() {
+#ifndef _WIN32
+  if (mapped_) munmap(mapped_, size_);
+#endif
+  mapped_ = nullptr;
+  data_ = nullptr;
+  size_ = 0;
+  pos_ = 0;
+  open_ = false;
+  std::vector<char>().swap(buffer_);
+}
@@ -0,0 +1,69 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsFileBuffer.h
+ * @brief
+ */
+#ifndef IO_HIGHS_FILE_BUFFER_H_
+#define IO_HIGHS_FILE_BUFFER_H_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Read-only view of the contents of a model file. Uncompressed files
+// are memory mapped where this is supported, so that they can be
+// parsed in place. Other files, including compressed ones, are read
+// into memory in one pass.
+class HighsFileBuffer {
+ public:
+  HighsFileBuffer() {}
+  ~HighsFileBuffer() { close(); }
+  HighsFileBuffer(const HighsFileBuffer&) = delete;
+  HighsFileBuffer& operator=(const HighsFileBuffer&) = delete;
+
+  bool open(const std::string& filename);
+  void close();
+  bool is_open() const { return open_; }
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+  // Gets the next line as the characters [begin, end), without the newline
+  bool nextLine(const char*& begin, const char*& end) {
+    if (pos_ >= size_) return false;
+    begin = data_ + pos_;
+    const char* newline = (const char*)memchr(begin, '\n', size_ - pos_);
+    end = newline ? newline : data_ + size_;
+    pos_ = end - data_ + 1;
+    return true;
+  }
+
+  // Copies the next line into line, with the semantics of std::getline
+  bool getline(std::string& line) {
+    const char* begin;
+    const char* end;
+    if (!nextLine(begin, end)) return false;
+    line.assign(begin, end);
+    return true;
+  }
+
+ private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t pos_ = 0;
+  bool open_ = false;
+  void* mapped_ = nullptr;
+  std::vector<char> buffer_;
+};
+
+#endif
@@ -26,7 +26,8 @@ using std::min;
 HighsStatus solveLpIpx(HighsLpSolverObject& solver_object) {
   return solveLpIpx(solver_object.options_, solver_object.timer_, solver_object.lp_, 
                     solver_object.basis_, solver_object.solution_, 
-                    solver_object.model_status_, solver_object.highs_info_);
+                    solver_object.model_status_, solver_object.highs_info_,
+                    solver_object.interrupt_flag_);
 }
 
 HighsStatus solveLpIpx(const HighsOptions& options,
@@ -35,7 +36,8 @@ HighsStatus solveLpIpx(const HighsOptions& options,
                        HighsBasis& highs_basis,
 		       HighsSolution& highs_solution,
                        HighsModelStatus& model_status,
-                       HighsInfo& highs_info) {
+                       HighsInfo& highs_info,
+                       const std::atomic<bool>* interrupt_flag) {
   // Use IPX to try to solve the LP
   //
   // Can return HighsModelStatus (HighsStatus) values:
@@ -101,6 +103,7 @@ HighsStatus solveLpIpx(const HighsOptions& options,
   // Determine the run time allowed for IPX
   parameters.time_limit = options.time_limit - timer.readRunHighsClock();
   parameters.ipm_maxiter = options.ipm_iteration_limit - highs_info.ipm_iteration_count;
+  parameters.kkt_solver = options.ipm_kkt_solver;
   // Determine if crossover is to be run or not
   if (options.run_crossover == kHighsOnString) {
     parameters.run_crossover = 1;
@@ -119,6 +122,8 @@ HighsStatus solveLpIpx(const HighsOptions& options,
 
   // Set the internal IPX parameters
   lps.SetParameters(parameters);
+  // Allow IPX to be interrupted if it is one of several concurrent solvers
+  lps.SetInterruptFlag(interrupt_flag);
 
   ipx::Int num_col, num_row;
   std::vector<ipx::Int> Ap, Ai;
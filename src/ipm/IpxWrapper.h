@@ -29,7 +29,8 @@ HighsStatus solveLpIpx(HighsLpSolverObject& solver_object);
 HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        const HighsLp& lp, HighsBasis& highs_basis,
                        HighsSolution& highs_solution,
-                       HighsModelStatus& model_status, HighsInfo& highs_info);
+                       HighsModelStatus& model_status, HighsInfo& highs_info,
+                       const std::atomic<bool>* interrupt_flag = nullptr);
 
 void fillInIpxData(const HighsLp& lp, ipx::Int& num_col, ipx::Int& num_row,
                    std::vector<double>& obj, std::vector<double>& col_lb,
@@ -11,6 +11,8 @@ Control::Control() {
 
 Int Control::InterruptCheck() const {
     HighsTaskExecutor::getThisWorkerDeque()->checkInterrupt();
+    if (interrupt_flag_ && interrupt_flag_->load(std::memory_order_relaxed))
+        return IPX_ERROR_interrupt_time;
     if (parameters_.time_limit >= 0.0 &&
         parameters_.time_limit < timer_.Elapsed())
         return IPX_ERROR_interrupt_time;
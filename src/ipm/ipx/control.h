@@ -1,6 +1,7 @@
 #ifndef IPX_CONTROL_H_
 #define IPX_CONTROL_H_
 
+#include <atomic>
 #include <fstream>
 #include <ostream>
 #include <sstream>
@@ -15,13 +16,12 @@ namespace ipx {
 // (1) accessing user parameters,
 // (2) solver output,
 // (3) solver interruption.
-// Currently the solver is interrupted only by time limit. The interrupt
-// mechanism could also be used if we run IPX and a simplex code concurrently
-// and want to interrupt IPX when the simplex finished. For that reason a
-// Control object cannot be copied; assuming that one thread sets an interrupt
-// signal (not implemented yet), a call to control.InterruptCheck() from any
-// part of the solver must return nonzero. Hence we must only have references or
-// pointers to a single Control object in the whole of IPX.
+// The solver is interrupted by time limit or by an interrupt flag that is set
+// from another thread, e.g. when IPX and a simplex code run concurrently and
+// the simplex finished first. For that reason a Control object cannot be
+// copied; once the interrupt flag is set, a call to control.InterruptCheck()
+// from any part of the solver must return nonzero. Hence we must only have
+// references or pointers to a single Control object in the whole of IPX.
 
 class Control {
 public:
@@ -38,6 +38,11 @@ public:
     // Returns IPX_ERROR_* if interrupt is requested, 0 otherwise.
     Int InterruptCheck() const;
 
+    // Sets a flag that is polled by InterruptCheck(). When the flag becomes
+    // true, the solver is interrupted as if the time limit was reached.
+    void interrupt_flag(const std::atomic<bool>* flag) {
+        interrupt_flag_ = flag; }
+
     // Returns output streams for log and debugging messages. The streams
     // evaluate to false if they discard output, so that we can write
     //
@@ -65,6 +70,7 @@ public:
     double ipm_drop_primal() const { return parameters_.ipm_drop_primal; }
     double ipm_drop_dual() const { return parameters_.ipm_drop_dual; }
     double kkt_tol() const { return parameters_.kkt_tol; }
+    ipxint kkt_solver() const { return parameters_.kkt_solver; }
     ipxint crash_basis() const { return parameters_.crash_basis; }
     double dependency_tol() const { return parameters_.dependency_tol; }
     double volume_tol() const { return parameters_.volume_tol; }
@@ -98,6 +104,7 @@ public:
 private:
     void MakeStream();           // composes output_
     Parameters parameters_;
+    const std::atomic<bool>* interrupt_flag_{nullptr};
     std::ofstream logfile_;
     Timer timer_;                // total runtime
     mutable Timer interval_;     // time since last interval log
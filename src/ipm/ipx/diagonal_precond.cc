@@ -1,13 +1,25 @@
 // Copyright (c) 2018-2019 ERGO-Code. See license.txt for license.
 
 #include "ipm/ipx/diagonal_precond.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <vector>
 #include "ipm/ipx/timer.h"
+#include "parallel/HighsParallel.h"
 
 namespace ipx {
 
+// When more than one thread is available and AI has at least this many
+// entries, the diagonal is built row-wise from AIt, so that blocks of rows can
+// be processed by different threads.
+static const Int kParallelMinEntries = 100000;
+
+// Apply() splits the rows into blocks of this size. The dot product is
+// accumulated per block and the partial sums are added in block order, so
+// that the result does not depend on the number of threads.
+static const Int kApplyBlockSize = 8192;
+
 DiagonalPrecond::DiagonalPrecond(const Model& model) : model_(model) {
     const Int m = model_.rows();
     diagonal_.resize(m);
@@ -21,7 +33,24 @@ void DiagonalPrecond::Factorize(const double* W, Info* info) {
     factorized_ = false;
 
     // Build diagonal of normal matrix.
-    if (W) {
+    if (highs::parallel::num_threads() > 1 &&
+        AI.entries() >= kParallelMinEntries) {
+        const SparseMatrix& AIt = model_.AIt();
+        const Int grain =
+            std::max(m / (4 * highs::parallel::num_threads()), (Int) 1);
+        highs::parallel::for_each(0, m, [&](Int begin_row, Int end_row) {
+            for (Int i = begin_row; i < end_row; i++) {
+                // The last entry of row i is the identity entry
+                // (rightmost m columns have weight zero if W is NULL).
+                double d = W ? W[n+i] : 0.0;
+                for (Int p = AIt.begin(i); p < AIt.end(i)-1; p++) {
+                    double w = W ? W[AIt.index(p)] : 1.0;
+                    d += AIt.value(p) * w * AIt.value(p);
+                }
+                diagonal_[i] = d;
+            }
+        }, grain);
+    } else if (W) {
         for (Int i = 0; i < m; i++)
             diagonal_[i] = W[n+i];
         for (Int j = 0; j < n; j++) {
@@ -58,9 +87,27 @@ void DiagonalPrecond::_Apply(const Vector& rhs, Vector& lhs,
     assert((Int)lhs.size() == m);
     assert((Int)rhs.size() == m);
 
-    for (Int i = 0; i < m; i++) {
-        lhs[i] = rhs[i] / diagonal_[i];
-        rldot += lhs[i] * rhs[i];
+    if (highs::parallel::num_threads() > 1 && m > kApplyBlockSize) {
+        const Int num_blocks = (m + kApplyBlockSize - 1) / kApplyBlockSize;
+        std::vector<double> block_rldot(num_blocks);
+        highs::parallel::for_each(0, num_blocks, [&](Int begin, Int end) {
+            for (Int b = begin; b < end; b++) {
+                const Int end_row = std::min((b+1) * kApplyBlockSize, m);
+                double d = 0.0;
+                for (Int i = b * kApplyBlockSize; i < end_row; i++) {
+                    lhs[i] = rhs[i] / diagonal_[i];
+                    d += lhs[i] * rhs[i];
+                }
+                block_rldot[b] = d;
+            }
+        });
+        for (Int b = 0; b < num_blocks; b++)
+            rldot += block_rldot[b];
+    } else {
+        for (Int i = 0; i < m; i++) {
+            lhs[i] = rhs[i] / diagonal_[i];
+            rldot += lhs[i] * rhs[i];
+        }
     }
     if (rhs_dot_lhs)
         *rhs_dot_lhs = rldot;
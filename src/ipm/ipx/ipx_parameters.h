@@ -27,6 +27,7 @@ struct ipx_parameters {
 
     /* Linear solver */
     double kkt_tol;
+    ipxint kkt_solver;  /* 0 = CR, 1 = sparse Cholesky of normal equations */
 
     /* Basis construction in IPM */
     ipxint crash_basis;
@@ -0,0 +1,202 @@
+#include "ipm/ipx/kkt_solver_chol.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "parallel/HighsCombinable.h"
+#include "parallel/HighsParallel.h"
+#include "ipm/ipx/utils.h"
+
+namespace ipx {
+
+// A pivot of the Cholesky factorization is treated as zero if it is not
+// larger than this value times the diagonal entry of the normal matrix.
+static const double kPivotTol = 1e-14;
+
+// Maximum number of iterative refinement steps per solve.
+static const Int kMaxRefinementSteps = 3;
+
+KKTSolverChol::KKTSolverChol(const Control& control, const Model& model) :
+    control_(control), model_(model), normal_matrix_(model) {
+    Int m = model_.rows();
+    Int n = model_.cols();
+    W_.resize(m+n);
+    resscale_.resize(m);
+}
+
+void KKTSolverChol::BuildPattern() {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+    std::vector<Int> mark(m, -1);
+
+    Mp_.assign(m+1, 0);
+    Mi_.clear();
+    for (Int k = 0; k < m; k++) {
+        mark[k] = k;
+        Mi_.push_back(k);
+        Int begin = Mi_.size();
+        for (Int p = AIt.begin(k); p < AIt.end(k); p++) {
+            Int j = AIt.index(p);
+            if (j >= n)
+                continue;
+            for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                Int i = AI.index(q);
+                if (i > k && mark[i] != k) {
+                    mark[i] = k;
+                    Mi_.push_back(i);
+                }
+            }
+        }
+        std::sort(Mi_.begin() + begin, Mi_.end());
+        Mp_[k+1] = Mi_.size();
+    }
+    Mx_.resize(Mi_.size());
+}
+
+void KKTSolverChol::ComputeValues() {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+
+    // Each thread scatters into its own position map.
+    auto position = makeHighsCombinable<std::vector<Int>>(
+        [m]() { return std::vector<Int>(m, -1); });
+    auto compute_columns = [&](Int begin, Int end) {
+        std::vector<Int>& pos = position.local();
+        for (Int k = begin; k < end; k++) {
+            for (Int p = Mp_[k]; p < Mp_[k+1]; p++) {
+                pos[Mi_[p]] = p;
+                Mx_[p] = 0.0;
+            }
+            Mx_[Mp_[k]] = W_[n+k];
+            for (Int p = AIt.begin(k); p < AIt.end(k); p++) {
+                Int j = AIt.index(p);
+                if (j >= n)
+                    continue;
+                double w = AIt.value(p) * W_[j];
+                for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                    Int i = AI.index(q);
+                    if (i >= k)
+                        Mx_[pos[i]] += w * AI.value(q);
+                }
+            }
+            for (Int p = Mp_[k]; p < Mp_[k+1]; p++)
+                pos[Mi_[p]] = -1;
+        }
+    };
+    const Int num_threads = highs::parallel::num_threads();
+    if (num_threads > 1) {
+        highs::parallel::for_each(
+            0, m, compute_columns, std::max(m / (4 * num_threads), (Int) 1));
+    } else {
+        compute_columns(0, m);
+    }
+}
+
+void KKTSolverChol::_Factorize(Iterate* pt, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    iter_ = 0;
+    factorized_ = false;
+
+    if (pt) {
+        const Vector& xl = pt->xl();
+        const Vector& xu = pt->xu();
+        const Vector& zl = pt->zl();
+        const Vector& zu = pt->zu();
+
+        // Build matrix W for AI*W*AI' and regularize free variables in the
+        // same way as KKTSolverDiag.
+        double regval = pt->mu();
+        for (Int j = 0; j < n+m; j++) {
+            assert(xl[j] > 0.0);
+            assert(xu[j] > 0.0);
+            double g = zl[j]/xl[j] + zu[j]/xu[j];
+            assert(std::isfinite(g));
+            if (g != 0.0 && g < regval)
+                regval = g;
+            W_[j] = 1.0 / g;        // infinity if g is zero
+        }
+        for (Int j = 0; j < n+m; j++) {
+            if (std::isinf(W_[j]))
+                W_[j] = 1.0 / regval;
+            assert(std::isfinite(W_[j]));
+            assert(W_[j] > 0.0);
+        }
+    } else {
+        W_ = 1.0;
+    }
+    for (Int i = 0; i < m; i++)
+        resscale_[i] = 1.0 / std::sqrt(W_[n+i]);
+    normal_matrix_.Prepare(&W_[0]);
+
+    if (!chol_.analyzed()) {
+        BuildPattern();
+        chol_.Analyze(m, Mp_.data(), Mi_.data());
+        control_.Debug(1)
+            << Textline("Normal matrix entries (lower):")
+            << Mi_.size() << '\n'
+            << Textline("Cholesky factor entries:")
+            << chol_.nnz_factor() << '\n'
+            << Textline("Cholesky supernodes:") << chol_.supernodes() << '\n';
+    }
+    if ((info->errflag = control_.InterruptCheck()) != 0)
+        return;
+    ComputeValues();
+    chol_.Factorize(Mx_.data(), kPivotTol);
+    if (chol_.dropped_pivots() > 0)
+        control_.Debug(1)
+            << Textline("Cholesky pivots dropped:")
+            << chol_.dropped_pivots() << '\n';
+    factorized_ = true;
+}
+
+// Reduces the KKT system to normal equations as in KKTSolverDiag, which are
+// solved by the Cholesky factorization. Iterative refinement is applied until
+// the scaled residual satisfies the tolerance required from the KKT solver.
+void KKTSolverChol::_Solve(const Vector& a, const Vector& b, double tol,
+                           Vector& x, Vector& y, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    assert(factorized_);
+
+    // Compose right-hand side AI*W*a-b.
+    Vector rhs = -b;
+    for (Int j = 0; j < n+m; j++)
+        ScatterColumn(AI, j, W_[j]*a[j], rhs);
+
+    // Solve normal equations.
+    y = rhs;
+    chol_.Solve(y);
+    Vector res(m);
+    for (Int step = 0; step < kMaxRefinementSteps; step++) {
+        normal_matrix_.Apply(y, res, nullptr);
+        res = rhs - res;
+        double resnorm = 0.0;
+        for (Int i = 0; i < m; i++)
+            resnorm = std::max(resnorm, std::abs(res[i] * resscale_[i]));
+        if (resnorm <= tol)
+            break;
+        chol_.Solve(res);
+        y += res;
+        iter_++;
+        info->kktiter1++;
+    }
+
+    // Recover solution to KKT system.
+    for (Int i = 0; i < m; i++)
+        x[n+i] = b[i];
+    for (Int j = 0; j < n; j++) {
+        double aty = DotColumn(AI, j, y);
+        x[j] = W_[j] * (a[j]-aty);
+        for (Int p = AI.begin(j); p < AI.end(j); p++) {
+            Int i = AI.index(p);
+            x[n+i] -= x[j] * AI.value(p);
+        }
+    }
+}
+
+}  // namespace ipx
@@ -0,0 +1,53 @@
+#ifndef IPX_KKT_SOLVER_CHOL_H_
+#define IPX_KKT_SOLVER_CHOL_H_
+
+#include <vector>
+#include "ipm/ipx/control.h"
+#include "ipm/ipx/kkt_solver.h"
+#include "ipm/ipx/model.h"
+#include "ipm/ipx/normal_matrix.h"
+#include "ipm/ipx/sparse_cholesky.h"
+
+namespace ipx {
+
+// KKTSolverChol implements a KKT solver that forms the normal equations
+// explicitly and solves them by a sparse Cholesky factorization, followed by
+// iterative refinement. The ordering and symbolic factorization are computed
+// in the first call to Factorize() and reused in subsequent calls. The (1,1)
+// block of the KKT matrix is regularized as in KKTSolverDiag.
+//
+// In the call to Factorize() @iterate is allowed to be NULL, in which case the
+// (1,1) block of the KKT matrix is the identity matrix.
+
+class KKTSolverChol : public KKTSolver {
+public:
+    KKTSolverChol(const Control& control, const Model& model);
+
+private:
+    void _Factorize(Iterate* iterate, Info* info) override;
+    void _Solve(const Vector& a, const Vector& b, double tol,
+                Vector& x, Vector& y, Info* info) override;
+    Int _iter() const override { return iter_; };
+
+    // Computes the pattern of the lower triangle of AI*W*AI'.
+    void BuildPattern();
+    // Computes the entries of AI*W*AI' for the current W.
+    void ComputeValues();
+
+    const Control& control_;
+    const Model& model_;
+    NormalMatrix normal_matrix_;   // for residuals in iterative refinement
+    SparseCholesky chol_;
+
+    std::vector<Int> Mp_;           // lower triangle of AI*W*AI' by columns,
+    std::vector<Int> Mi_;           // diagonal entry first in each column
+    std::vector<double> Mx_;
+    Vector W_;               // diagonal matrix in AI*W*AI'
+    Vector resscale_;        // residual scaling factors for refinement test
+    bool factorized_{false}; // KKT matrix factorized?
+    Int iter_{0};            // # refinement steps since last Factorize()
+};
+
+}  // namespace ipx
+
+#endif  // IPX_KKT_SOLVER_CHOL_H_
@@ -6,6 +6,7 @@
 #include "ipm/ipx/crossover.h"
 #include "ipm/ipx/info.h"
 #include "ipm/ipx/kkt_solver_basis.h"
+#include "ipm/ipx/kkt_solver_chol.h"
 #include "ipm/ipx/kkt_solver_diag.h"
 #include "ipm/ipx/starting_basis.h"
 #include "ipm/ipx/utils.h"
@@ -155,6 +156,10 @@ void LpSolver::SetParameters(Parameters new_parameters) {
     control_.parameters(new_parameters);
 }
 
+void LpSolver::SetInterruptFlag(const std::atomic<bool>* flag) {
+    control_.interrupt_flag(flag);
+}
+
 void LpSolver::ClearModel() {
     model_.clear();
     ClearSolution();
@@ -381,10 +386,16 @@ void LpSolver::RunIPM() {
                              y_start_, zl_start_, zu_start_);
     }
     else {
-        ComputeStartingPoint(ipm);
+        // With a direct KKT solver, the same instance is used for the
+        // starting point and the initial IPM so that its symbolic
+        // factorization is computed only once.
+        std::unique_ptr<KKTSolver> kkt;
+        if (control_.kkt_solver() == 1)
+            kkt.reset(new KKTSolverChol(control_, model_));
+        ComputeStartingPoint(ipm, kkt.get());
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
-        RunInitialIPM(ipm);
+        RunInitialIPM(ipm, kkt.get());
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
     }
@@ -449,32 +460,38 @@ void LpSolver::MakeIPMStartingPointValid() {
     }
 }
 
-void LpSolver::ComputeStartingPoint(IPM& ipm) {
+void LpSolver::ComputeStartingPoint(IPM& ipm, KKTSolver* kkt) {
     Timer timer;
-    KKTSolverDiag kkt(control_, model_);
+    KKTSolverDiag kkt_diag(control_, model_);
+    if (!kkt)
+        kkt = &kkt_diag;
 
     // If the starting point procedure fails, then iterate_ remains as
     // initialized by the constructor, which is a valid state for
     // postprocessing/postsolving.
-    ipm.StartingPoint(&kkt, iterate_.get(), &info_);
+    ipm.StartingPoint(kkt, iterate_.get(), &info_);
     info_.time_ipm1 += timer.Elapsed();
 }
 
-void LpSolver::RunInitialIPM(IPM& ipm) {
+void LpSolver::RunInitialIPM(IPM& ipm, KKTSolver* kkt) {
     Timer timer;
-    KKTSolverDiag kkt(control_, model_);
+    KKTSolverDiag kkt_diag(control_, model_);
 
     Int switchiter = control_.switchiter();
     if (switchiter < 0) {
         // Switch iteration not specified by user. Run as long as KKT solver
-        // converges within min(500,10+m/20) iterations.
+        // converges within min(500,10+m/20) iterations. A direct KKT solver
+        // does not slow down as the IPM converges, so is used until the IPM
+        // terminates.
         Int m = model_.rows();
-        kkt.maxiter(std::min(500l, (long) (10+m/20) ));
+        kkt_diag.maxiter(std::min(500l, (long) (10+m/20) ));
         ipm.maxiter(control_.ipm_maxiter());
     } else {
         ipm.maxiter(std::min(switchiter, control_.ipm_maxiter()));
     }
-    ipm.Driver(&kkt, iterate_.get(), &info_);
+    if (!kkt)
+        kkt = &kkt_diag;
+    ipm.Driver(kkt, iterate_.get(), &info_);
     switch (info_.status_ipm) {
     case IPX_STATUS_optimal:
         // If the IPM reached its termination criterion in the initial
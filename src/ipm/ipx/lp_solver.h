@@ -98,6 +98,10 @@ public:
     Parameters GetParameters() const;
     void SetParameters(Parameters new_parameters);
 
+    // Sets a flag that interrupts the solver when it becomes true. The flag
+    // may be set from another thread. A null pointer disables the check.
+    void SetInterruptFlag(const std::atomic<bool>* flag);
+
     // Discards the model and solution (if any) but keeps the parameters.
     void ClearModel();
 
@@ -164,8 +168,9 @@ private:
     void InteriorPointSolve();
     void RunIPM();
     void MakeIPMStartingPointValid();
-    void ComputeStartingPoint(IPM& ipm);
-    void RunInitialIPM(IPM& ipm);
+    // If @kkt is NULL, KKTSolverDiag is used.
+    void ComputeStartingPoint(IPM& ipm, KKTSolver* kkt);
+    void RunInitialIPM(IPM& ipm, KKTSolver* kkt);
     void BuildStartingBasis();
     void RunMainIPM(IPM& ipm);
     void BuildCrossoverStartingPoint();
@@ -1,7 +1,9 @@
 #include "ipm/ipx/normal_matrix.h"
+#include <algorithm>
 #include <cassert>
 #include "ipm/ipx/timer.h"
 #include "ipm/ipx/utils.h"
+#include "parallel/HighsParallel.h"
 
 namespace ipx {
 
@@ -19,6 +21,14 @@ namespace ipx {
 // matrix-vector products of the form AA' here and in SplittedNormalMatrix.
 #define MATVECMETHOD 1
 
+// When more than one thread is available and AI has at least this many
+// entries, matrix-vector products are computed by ApplyParallel().
+// The one-pass variant scatters into lhs and cannot be split between
+// threads. Instead, the first pass over the columns of AI and the second pass
+// over its rows (the columns of AIt) are split into blocks of columns/rows,
+// each of which writes only its own part of the result.
+static const Int kParallelMinEntries = 100000;
+
 NormalMatrix::NormalMatrix(const Model& model) : model_(model) {
     #if MATVECMETHOD > 1
     // The two-pass variants require n+m workspace to store the intermediate
@@ -58,7 +68,10 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     assert((Int)lhs.size() == m);
     assert((Int)rhs.size() == m);
 
-    if (W_) {
+    if (highs::parallel::num_threads() > 1 &&
+        model_.AI().entries() >= kParallelMinEntries) {
+        ApplyParallel(rhs, lhs);
+    } else if (W_) {
         #if MATVECMETHOD == 1
         for (Int i = 0; i < m; i++)
             lhs[i] = rhs[i] * W_[n+i];
@@ -123,4 +136,46 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     time_ += timer.Elapsed();
 }
 
+void NormalMatrix::ApplyParallel(const Vector& rhs, Vector& lhs) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const Int* Ap = model_.AI().colptr();
+    const Int* Ai = model_.AI().rowidx();
+    const double* Ax = model_.AI().values();
+    const Int* Atp = model_.AIt().colptr();
+    const Int* Ati = model_.AIt().rowidx();
+    const double* Atx = model_.AIt().values();
+    const double* W = W_;
+    if ((Int)work_.size() < n)
+        work_.resize(n);
+
+    // Use a few blocks per thread to balance the load.
+    const Int num_blocks = 4 * highs::parallel::num_threads();
+    const Int col_grain = std::max(n / num_blocks, (Int) 1);
+    const Int row_grain = std::max(m / num_blocks, (Int) 1);
+
+    // First pass: work = W*AI'*rhs, restricted to the first n columns.
+    highs::parallel::for_each(0, n, [&](Int begin_col, Int end_col) {
+        for (Int j = begin_col; j < end_col; j++) {
+            double d = 0.0;
+            for (Int p = Ap[j]; p < Ap[j+1]; p++)
+                d += rhs[Ai[p]] * Ax[p];
+            work_[j] = W ? d * W[j] : d;
+        }
+    }, col_grain);
+
+    // Second pass: lhs = AI*work plus the contribution of the identity
+    // columns, which have weight zero if W is NULL.
+    highs::parallel::for_each(0, m, [&](Int begin_row, Int end_row) {
+        for (Int i = begin_row; i < end_row; i++) {
+            double d = W ? rhs[i] * W[n+i] : 0.0;
+            Int begin = Atp[i], end = Atp[i+1]-1; // skip identity entry
+            assert(Ati[end] == n+i);
+            for (Int p = begin; p < end; p++)
+                d += work_[Ati[p]] * Atx[p];
+            lhs[i] = d;
+        }
+    }, row_grain);
+}
+
 }  // namespace ipx
@@ -31,11 +31,15 @@ public:
 
 private:
     void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+    // Computes lhs = AI*W*AI'*rhs in two passes that can be run by several
+    // threads without write conflicts.
+    void ApplyParallel(const Vector& rhs, Vector& lhs);
 
     const Model& model_;
     const double* W_{nullptr};
     bool prepared_{false};
     Vector work_;            // size n+m workspace (2-pass matvec products only)
+                             // size n workspace (parallel matvec products)
     double time_{0.0};
 };
 
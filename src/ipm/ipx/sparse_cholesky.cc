@@ -0,0 +1,610 @@
+#include "ipm/ipx/sparse_cholesky.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "parallel/HighsParallel.h"
+
+namespace ipx {
+
+// A pivot that fails the test in Factorize() is replaced by this value. The
+// entries of its column in L become negligible and the corresponding component
+// of solutions becomes zero.
+static const double kHugePivot = 1e128;
+
+// Number of columns of a frontal matrix that are factorized as one panel
+// before the trailing columns are updated.
+static const Int kPanelSize = 32;
+
+// The trailing columns of a frontal matrix are updated by several threads if
+// there are at least this many of them.
+static const Int kParallelMinUpdateCols = 256;
+
+// Approximate minimum degree ordering on the quotient graph of M. Eliminated
+// variables become elements, which represent the cliques formed by fill. The
+// external degree of a variable i adjacent to the new element p is bounded by
+//
+//   |A_i| + |L_p \ i| + sum_{e in E_i, e != p} |L_e \ L_p|,
+//
+// where A_i are the variables and E_i the elements adjacent to i, and L_e are
+// the variables of element e. Elements that are adjacent to p are absorbed.
+void SparseCholesky::ComputeOrdering(const Int* colptr, const Int* rowidx) {
+    const Int n = dim_;
+    std::vector<std::vector<Int>> var_adj(n);   // A_i
+    std::vector<std::vector<Int>> elem_adj(n);  // E_i
+    std::vector<std::vector<Int>> elem_vars(n); // L_e
+    for (Int j = 0; j < n; j++) {
+        for (Int p = colptr[j]; p < colptr[j+1]; p++) {
+            Int i = rowidx[p];
+            if (i != j) {
+                var_adj[i].push_back(j);
+                var_adj[j].push_back(i);
+            }
+        }
+    }
+    for (Int i = 0; i < n; i++) {
+        std::sort(var_adj[i].begin(), var_adj[i].end());
+        var_adj[i].erase(std::unique(var_adj[i].begin(), var_adj[i].end()),
+                         var_adj[i].end());
+    }
+
+    // Status is 0 for a variable, 1 for an element and 2 for an absorbed
+    // element.
+    std::vector<Int> status(n, 0);
+    std::vector<Int> degree(n);
+    std::vector<Int> mark(n, 0);
+    std::vector<Int> wcount(n, -1);
+    Int stamp = 0;
+
+    // Doubly linked lists of variables with equal degree.
+    std::vector<Int> head(n, -1), next(n, -1), prev(n, -1);
+    Int min_degree = n;
+    auto insert = [&](Int i) {
+        Int d = degree[i];
+        prev[i] = -1;
+        next[i] = head[d];
+        if (head[d] >= 0)
+            prev[head[d]] = i;
+        head[d] = i;
+        min_degree = std::min(min_degree, d);
+    };
+    auto remove = [&](Int i) {
+        if (prev[i] >= 0)
+            next[prev[i]] = next[i];
+        else
+            head[degree[i]] = next[i];
+        if (next[i] >= 0)
+            prev[next[i]] = prev[i];
+    };
+    for (Int i = 0; i < n; i++) {
+        degree[i] = var_adj[i].size();
+        insert(i);
+    }
+
+    perm_.clear();
+    perm_.reserve(n);
+    std::vector<Int> Lp, touched;
+    for (Int k = 0; k < n; k++) {
+        while (head[min_degree] < 0)
+            min_degree++;
+        const Int p = head[min_degree];
+        remove(p);
+        perm_.push_back(p);
+
+        // Form the new element from the variables adjacent to p, directly or
+        // through elements, and absorb these elements.
+        stamp++;
+        mark[p] = stamp;
+        Lp.clear();
+        for (Int e : elem_adj[p]) {
+            if (status[e] != 1)
+                continue;
+            for (Int v : elem_vars[e]) {
+                if (status[v] == 0 && mark[v] != stamp) {
+                    mark[v] = stamp;
+                    Lp.push_back(v);
+                }
+            }
+            status[e] = 2;
+            std::vector<Int>().swap(elem_vars[e]);
+        }
+        for (Int v : var_adj[p]) {
+            if (status[v] == 0 && mark[v] != stamp) {
+                mark[v] = stamp;
+                Lp.push_back(v);
+            }
+        }
+        status[p] = 1;
+        elem_vars[p] = Lp;
+        std::vector<Int>().swap(var_adj[p]);
+        std::vector<Int>().swap(elem_adj[p]);
+
+        // Replace the absorbed elements by p in the element lists, and remove
+        // variables that are now adjacent through p from the variable lists.
+        for (Int i : Lp) {
+            remove(i);
+            std::vector<Int>& Ei = elem_adj[i];
+            Ei.erase(std::remove_if(Ei.begin(), Ei.end(),
+                                    [&](Int e) { return status[e] != 1; }),
+                     Ei.end());
+            Ei.push_back(p);
+            std::vector<Int>& Ai = var_adj[i];
+            Ai.erase(std::remove_if(Ai.begin(), Ai.end(), [&](Int v) {
+                         return status[v] != 0 || mark[v] == stamp; }),
+                     Ai.end());
+        }
+
+        // Compute |L_e \ L_p| for all elements e adjacent to L_p.
+        touched.clear();
+        for (Int i : Lp) {
+            for (Int e : elem_adj[i]) {
+                if (e == p)
+                    continue;
+                if (wcount[e] < 0) {
+                    wcount[e] = elem_vars[e].size();
+                    touched.push_back(e);
+                }
+                wcount[e]--;
+            }
+        }
+        const Int Lp_size = Lp.size();
+        const Int remaining = n-k-1;
+        for (Int i : Lp) {
+            Int d = var_adj[i].size() + Lp_size - 1;
+            for (Int e : elem_adj[i])
+                if (e != p)
+                    d += wcount[e];
+            d = std::min(d, degree[i] + Lp_size - 1);
+            degree[i] = std::max(std::min(d, remaining - 1), (Int) 0);
+            insert(i);
+        }
+        for (Int e : touched)
+            wcount[e] = -1;
+        // Remove variables of L_p from elements that are entirely covered by
+        // p. These elements carry no additional information and are absorbed.
+        for (Int e : touched) {
+            if (status[e] == 1) {
+                bool covered = true;
+                for (Int v : elem_vars[e]) {
+                    if (status[v] == 0 && mark[v] != stamp) {
+                        covered = false;
+                        break;
+                    }
+                }
+                if (covered) {
+                    status[e] = 2;
+                    std::vector<Int>().swap(elem_vars[e]);
+                }
+            }
+        }
+    }
+    assert((Int)perm_.size() == n);
+}
+
+void SparseCholesky::Analyze(Int dim, const Int* colptr, const Int* rowidx) {
+    const Int n = dim;
+    dim_ = dim;
+    analyzed_ = false;
+    factorized_ = false;
+    ComputeOrdering(colptr, rowidx);
+
+    // Elimination tree of the permuted matrix.
+    std::vector<Int> iperm(n);
+    for (Int k = 0; k < n; k++)
+        iperm[perm_[k]] = k;
+    std::vector<std::vector<Int>> row_pattern(n);
+    for (Int j = 0; j < n; j++) {
+        for (Int p = colptr[j]; p < colptr[j+1]; p++) {
+            Int pi = iperm[rowidx[p]], pj = iperm[j];
+            if (pi != pj)
+                row_pattern[std::max(pi, pj)].push_back(std::min(pi, pj));
+        }
+    }
+    std::vector<Int> parent(n, -1), ancestor(n, -1);
+    for (Int k = 0; k < n; k++) {
+        for (Int i : row_pattern[k]) {
+            // Walk from i to the root of its subtree with path compression.
+            while (i >= 0 && i != k) {
+                Int next = ancestor[i];
+                ancestor[i] = k;
+                if (next < 0)
+                    parent[i] = k;
+                i = next;
+            }
+        }
+    }
+    row_pattern.clear();
+
+    // Postorder the elimination tree so that the columns of each subtree, and
+    // hence of each supernode, are numbered consecutively.
+    std::vector<Int> tree_head(n, -1), tree_next(n, -1);
+    for (Int j = n-1; j >= 0; j--) {
+        if (parent[j] >= 0) {
+            tree_next[j] = tree_head[parent[j]];
+            tree_head[parent[j]] = j;
+        }
+    }
+    std::vector<Int> post, stack;
+    post.reserve(n);
+    for (Int root = 0; root < n; root++) {
+        if (parent[root] >= 0)
+            continue;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            Int j = stack.back();
+            Int child = tree_head[j];
+            if (child < 0) {
+                post.push_back(j);
+                stack.pop_back();
+            } else {
+                tree_head[j] = tree_next[child];
+                stack.push_back(child);
+            }
+        }
+    }
+    assert((Int)post.size() == n);
+    std::vector<Int> ipost(n);
+    for (Int k = 0; k < n; k++)
+        ipost[post[k]] = k;
+    std::vector<Int> new_perm(n), new_parent(n);
+    for (Int k = 0; k < n; k++) {
+        new_perm[k] = perm_[post[k]];
+        new_parent[k] = parent[post[k]] >= 0 ? ipost[parent[post[k]]] : -1;
+    }
+    perm_.swap(new_perm);
+    parent.swap(new_parent);
+    for (Int k = 0; k < n; k++)
+        iperm[perm_[k]] = k;
+
+    // Lower triangle of the permuted matrix by columns, keeping the position
+    // of each entry in the input.
+    std::vector<Int> Pp(n+1, 0);
+    for (Int j = 0; j < n; j++)
+        for (Int p = colptr[j]; p < colptr[j+1]; p++)
+            Pp[std::min(iperm[rowidx[p]], iperm[j])+1]++;
+    for (Int k = 0; k < n; k++)
+        Pp[k+1] += Pp[k];
+    const Int nz = Pp[n];
+    std::vector<Int> Pi(nz), Psrc(nz), fill(Pp.begin(), Pp.end()-1);
+    diag_src_.assign(n, -1);
+    for (Int j = 0; j < n; j++) {
+        for (Int p = colptr[j]; p < colptr[j+1]; p++) {
+            Int pi = iperm[rowidx[p]], pj = iperm[j];
+            Int col = std::min(pi, pj);
+            Int put = fill[col]++;
+            Pi[put] = std::max(pi, pj);
+            Psrc[put] = p;
+            if (pi == pj)
+                diag_src_[pi] = p;
+        }
+    }
+
+    // Column counts and fundamental supernodes. The pattern of column j of L
+    // is the union of the pattern of column j of the permuted matrix and the
+    // patterns of the children of j, without j itself.
+    std::vector<Int> num_child(n, 0);
+    for (Int j = 0; j < n; j++)
+        if (parent[j] >= 0)
+            num_child[parent[j]]++;
+    std::vector<std::vector<Int>> col_pattern(n);
+    std::vector<Int> col_count(n);
+    std::vector<Int> mark(n, -1);
+    std::vector<std::vector<Int>> pending(n);   // children patterns
+    for (Int j = 0; j < n; j++) {
+        std::vector<Int>& pattern = col_pattern[j];
+        mark[j] = j;
+        for (Int p = Pp[j]; p < Pp[j+1]; p++) {
+            Int i = Pi[p];
+            if (mark[i] != j) {
+                mark[i] = j;
+                pattern.push_back(i);
+            }
+        }
+        for (Int c : pending[j]) {
+            for (Int i : col_pattern[c]) {
+                if (mark[i] != j) {
+                    mark[i] = j;
+                    pattern.push_back(i);
+                }
+            }
+        }
+        std::vector<Int>().swap(pending[j]);
+        std::sort(pattern.begin(), pattern.end());
+        col_count[j] = pattern.size() + 1;
+        if (parent[j] >= 0)
+            pending[parent[j]].push_back(j);
+    }
+
+    // Column j+1 belongs to the supernode of column j if j is its only child
+    // and L has the same pattern in both columns below the diagonal block.
+    super_start_.clear();
+    std::vector<Int> col2super(n);
+    for (Int j = 0; j < n; j++) {
+        bool extend = j > 0 && parent[j-1] == j && num_child[j] == 1 &&
+            col_count[j-1] == col_count[j] + 1;
+        if (!extend)
+            super_start_.push_back(j);
+        col2super[j] = super_start_.size()-1;
+    }
+    num_super_ = super_start_.size();
+    super_start_.push_back(n);
+
+    // Row patterns of supernodes and the supernodal elimination tree.
+    const Int ns = num_super_;
+    rows_start_.assign(ns+1, 0);
+    rows_.clear();
+    super_parent_.assign(ns, -1);
+    for (Int s = 0; s < ns; s++) {
+        Int first = super_start_[s];
+        Int last = super_start_[s+1]-1;
+        rows_.push_back(first);
+        rows_.insert(rows_.end(), col_pattern[first].begin(),
+                     col_pattern[first].end());
+        rows_start_[s+1] = rows_.size();
+        if (parent[last] >= 0)
+            super_parent_[s] = col2super[parent[last]];
+    }
+    col_pattern.clear();
+
+    child_start_.assign(ns+1, 0);
+    for (Int s = 0; s < ns; s++)
+        if (super_parent_[s] >= 0)
+            child_start_[super_parent_[s]+1]++;
+    for (Int s = 0; s < ns; s++)
+        child_start_[s+1] += child_start_[s];
+    child_.resize(child_start_[ns]);
+    std::vector<Int> child_fill(child_start_.begin(), child_start_.end()-1);
+    for (Int s = 0; s < ns; s++)
+        if (super_parent_[s] >= 0)
+            child_[child_fill[super_parent_[s]]++] = s;
+
+    // Supernodes are numbered in postorder, so the subtree of s consists of
+    // the supernodes first_desc_[s],...,s.
+    first_desc_.resize(ns);
+    subtree_work_.resize(ns);
+    for (Int s = 0; s < ns; s++) {
+        first_desc_[s] = s;
+        double nr = rows(s), nc = cols(s);
+        subtree_work_[s] = nc * nr * nr;
+    }
+    for (Int s = 0; s < ns; s++) {
+        Int p = super_parent_[s];
+        if (p >= 0) {
+            first_desc_[p] = std::min(first_desc_[p], first_desc_[s]);
+            subtree_work_[p] += subtree_work_[s];
+        }
+    }
+
+    // Positions of the entries of M and of the rows of update matrices in the
+    // frontal matrices.
+    std::vector<Int> position(n, -1);
+    assemble_start_.assign(ns+1, 0);
+    assemble_src_.clear();
+    assemble_dst_.clear();
+    relind_start_.assign(ns+1, 0);
+    relind_.clear();
+    for (Int s = 0; s < ns; s++) {
+        const std::size_t nr = rows(s);
+        for (Int t = rows_start_[s]; t < rows_start_[s+1]; t++)
+            position[rows_[t]] = t - rows_start_[s];
+        for (Int j = super_start_[s]; j < super_start_[s+1]; j++) {
+            std::size_t lcol = j - super_start_[s];
+            for (Int p = Pp[j]; p < Pp[j+1]; p++) {
+                assert(position[Pi[p]] >= 0);
+                assemble_src_.push_back(Psrc[p]);
+                assemble_dst_.push_back(position[Pi[p]] + lcol*nr);
+            }
+        }
+        assemble_start_[s+1] = assemble_src_.size();
+        for (Int k = child_start_[s]; k < child_start_[s+1]; k++) {
+            Int c = child_[k];
+            relind_start_[c] = relind_.size();
+            for (Int t = rows_start_[c]+cols(c); t < rows_start_[c+1]; t++) {
+                assert(position[rows_[t]] >= 0);
+                relind_.push_back(position[rows_[t]]);
+            }
+        }
+        for (Int t = rows_start_[s]; t < rows_start_[s+1]; t++)
+            position[rows_[t]] = -1;
+    }
+
+    factor_start_.assign(ns+1, 0);
+    for (Int s = 0; s < ns; s++)
+        factor_start_[s+1] = factor_start_[s] +
+            (std::size_t) rows(s) * (std::size_t) cols(s);
+    factor_.clear();
+    update_.clear();
+    update_.resize(ns);
+    analyzed_ = true;
+}
+
+std::size_t SparseCholesky::nnz_factor() const {
+    std::size_t nnz = 0;
+    for (Int s = 0; s < num_super_; s++) {
+        std::size_t nr = rows(s), nc = cols(s);
+        nnz += nc*nr - nc*(nc-1)/2;
+    }
+    return nnz;
+}
+
+void SparseCholesky::FactorizeSupernode(Int s, const double* values,
+                                        double pivot_tol, Int* dropped) {
+    const Int nr = rows(s);
+    const Int nc = cols(s);
+    const Int* srows = &rows_[rows_start_[s]];
+    std::vector<double> front((std::size_t) nr * nr, 0.0);
+    auto F = [&](Int i, Int j) -> double& {
+        return front[i + (std::size_t) j * nr];
+    };
+
+    // Assemble entries of M and update matrices of the children.
+    for (Int k = assemble_start_[s]; k < assemble_start_[s+1]; k++)
+        front[assemble_dst_[k]] += values[assemble_src_[k]];
+    for (Int k = child_start_[s]; k < child_start_[s+1]; k++) {
+        const Int c = child_[k];
+        const Int nu = rows(c) - cols(c);
+        const Int* rel = &relind_[relind_start_[c]];
+        std::vector<double>& update = update_[c];
+        assert((Int)update.size() == nu*nu);
+        for (Int j = 0; j < nu; j++) {
+            const double* ucol = &update[(std::size_t) j * nu];
+            double* fcol = &F(0, rel[j]);
+            for (Int i = j; i < nu; i++)
+                fcol[rel[i]] += ucol[i];
+        }
+        std::vector<double>().swap(update);
+    }
+
+    // Right-looking factorization of the first nc columns, which also forms
+    // the Schur complement in the trailing nr-nc columns.
+    for (Int k0 = 0; k0 < nc; k0 += kPanelSize) {
+        const Int k1 = std::min(k0 + kPanelSize, nc);
+        for (Int k = k0; k < k1; k++) {
+            double d = F(k, k);
+            Int src = diag_src_[srows[k]];
+            double mkk = src >= 0 ? std::abs(values[src]) : 0.0;
+            if (!(d > pivot_tol * mkk) || !std::isfinite(d)) {
+                d = kHugePivot;
+                (*dropped)++;
+            }
+            const double lkk = std::sqrt(d);
+            double* lcol = &F(0, k);
+            lcol[k] = lkk;
+            for (Int i = k+1; i < nr; i++)
+                lcol[i] /= lkk;
+            for (Int j = k+1; j < k1; j++) {
+                const double ljk = lcol[j];
+                double* fcol = &F(0, j);
+                for (Int i = j; i < nr; i++)
+                    fcol[i] -= lcol[i] * ljk;
+            }
+        }
+        // Update the columns right of the panel.
+        auto update_cols = [&](Int begin, Int end) {
+            for (Int j = begin; j < end; j++) {
+                double* fcol = &F(0, j);
+                for (Int k = k0; k < k1; k++) {
+                    const double* lcol = &F(0, k);
+                    const double ljk = lcol[j];
+                    if (ljk == 0.0)
+                        continue;
+                    for (Int i = j; i < nr; i++)
+                        fcol[i] -= lcol[i] * ljk;
+                }
+            }
+        };
+        if (nr - k1 >= kParallelMinUpdateCols &&
+            highs::parallel::num_threads() > 1) {
+            // Columns further right are longer, which is balanced by the
+            // work stealing of the scheduler.
+            highs::parallel::for_each(k1, nr, update_cols, 32);
+        } else {
+            update_cols(k1, nr);
+        }
+    }
+
+    // Store the columns of L and the update matrix for the parent.
+    std::copy(front.begin(), front.begin() + (std::size_t) nc * nr,
+              factor_.begin() + factor_start_[s]);
+    const Int nu = nr - nc;
+    if (nu > 0 && super_parent_[s] >= 0) {
+        std::vector<double>& update = update_[s];
+        update.resize((std::size_t) nu * nu);
+        for (Int j = 0; j < nu; j++)
+            std::copy(&F(nc+j, nc+j), &F(0, nc+j) + nr,
+                      update.begin() + (std::size_t) j * nu + j);
+    }
+}
+
+void SparseCholesky::Factorize(const double* values, double pivot_tol) {
+    assert(analyzed_);
+    const Int ns = num_super_;
+    factorized_ = false;
+    factor_.assign(factor_start_[ns], 0.0);
+
+    const Int num_threads = highs::parallel::num_threads();
+    if (num_threads <= 1) {
+        Int dropped = 0;
+        for (Int s = 0; s < ns; s++)
+            FactorizeSupernode(s, values, pivot_tol, &dropped);
+        dropped_pivots_ = dropped;
+        factorized_ = true;
+        return;
+    }
+
+    // Subtrees with little work are factorized by independent tasks. The
+    // remaining supernodes near the roots are then factorized in postorder,
+    // with their dense updates split between threads.
+    double total_work = 0.0;
+    for (Int s = 0; s < ns; s++)
+        if (super_parent_[s] < 0)
+            total_work += subtree_work_[s];
+    const double subtree_limit = total_work / (4.0 * num_threads);
+    std::vector<Int> subtree_roots;
+    std::vector<Int> top;
+    for (Int s = 0; s < ns; s++) {
+        if (subtree_work_[s] > subtree_limit)
+            top.push_back(s);
+        else if (super_parent_[s] < 0 ||
+                 subtree_work_[super_parent_[s]] > subtree_limit)
+            subtree_roots.push_back(s);
+    }
+    std::vector<Int> subtree_dropped(subtree_roots.size(), 0);
+    highs::parallel::for_each(0, subtree_roots.size(),
+                              [&](Int begin, Int end) {
+        for (Int t = begin; t < end; t++) {
+            const Int root = subtree_roots[t];
+            for (Int s = first_desc_[root]; s <= root; s++)
+                FactorizeSupernode(s, values, pivot_tol, &subtree_dropped[t]);
+        }
+    });
+    Int dropped = 0;
+    for (Int d : subtree_dropped)
+        dropped += d;
+    for (Int s : top)
+        FactorizeSupernode(s, values, pivot_tol, &dropped);
+    dropped_pivots_ = dropped;
+    factorized_ = true;
+}
+
+void SparseCholesky::Solve(Vector& rhs) const {
+    assert(factorized_);
+    const Int n = dim_;
+    std::vector<double> x(n);
+    for (Int k = 0; k < n; k++)
+        x[k] = rhs[perm_[k]];
+
+    // Solve with L.
+    for (Int s = 0; s < num_super_; s++) {
+        const Int nr = rows(s);
+        const Int nc = cols(s);
+        const Int* srows = &rows_[rows_start_[s]];
+        const double* L = &factor_[factor_start_[s]];
+        for (Int k = 0; k < nc; k++) {
+            const double* lcol = L + (std::size_t) k * nr;
+            double xk = x[srows[k]] / lcol[k];
+            x[srows[k]] = xk;
+            if (xk != 0.0)
+                for (Int i = k+1; i < nr; i++)
+                    x[srows[i]] -= lcol[i] * xk;
+        }
+    }
+    // Solve with L'.
+    for (Int s = num_super_-1; s >= 0; s--) {
+        const Int nr = rows(s);
+        const Int nc = cols(s);
+        const Int* srows = &rows_[rows_start_[s]];
+        const double* L = &factor_[factor_start_[s]];
+        for (Int k = nc-1; k >= 0; k--) {
+            const double* lcol = L + (std::size_t) k * nr;
+            double xk = x[srows[k]];
+            for (Int i = k+1; i < nr; i++)
+                xk -= lcol[i] * x[srows[i]];
+            x[srows[k]] = xk / lcol[k];
+        }
+    }
+
+    for (Int k = 0; k < n; k++)
+        rhs[perm_[k]] = x[k];
+}
+
+}  // namespace ipx
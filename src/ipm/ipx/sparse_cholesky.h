@@ -0,0 +1,90 @@
+#ifndef IPX_SPARSE_CHOLESKY_H_
+#define IPX_SPARSE_CHOLESKY_H_
+
+#include <cstddef>
+#include <vector>
+#include "ipm/ipx/ipx_internal.h"
+
+namespace ipx {
+
+// SparseCholesky computes a supernodal Cholesky factorization
+//
+//   P*M*P' = L*L'
+//
+// of a symmetric positive (semi)definite matrix M. P is a fill-reducing
+// permutation from an approximate minimum degree ordering, followed by a
+// postordering of the elimination tree.
+//
+// Analyze() computes the ordering and the symbolic factorization from the
+// pattern of M. The symbolic factorization is reused by any number of calls to
+// Factorize() for matrices with the same pattern. The numeric factorization is
+// multifrontal. Independent subtrees of the supernodal elimination tree are
+// factorized concurrently, and the dense updates of large frontal matrices are
+// split between threads.
+
+class SparseCholesky {
+public:
+    // Computes ordering and symbolic factorization of a matrix of dimension
+    // @dim. The lower triangle of M, including the diagonal, is given in
+    // compressed column format. Each column must contain its diagonal entry.
+    void Analyze(Int dim, const Int* colptr, const Int* rowidx);
+
+    // Computes the numeric factorization. @values holds the entries of M in
+    // the order of the pattern given to Analyze(). A pivot that is not larger
+    // than @pivot_tol times the diagonal entry of M is replaced by a huge
+    // value, so that the corresponding component of solutions becomes zero.
+    void Factorize(const double* values, double pivot_tol);
+
+    // Overwrites @rhs by the solution to M*x = rhs.
+    void Solve(Vector& rhs) const;
+
+    bool analyzed() const { return analyzed_; }
+    bool factorized() const { return factorized_; }
+    Int dim() const { return dim_; }
+    Int supernodes() const { return num_super_; }
+    std::size_t nnz_factor() const; // # entries in L
+    Int dropped_pivots() const { return dropped_pivots_; }
+
+private:
+    void ComputeOrdering(const Int* colptr, const Int* rowidx);
+    void FactorizeSupernode(Int s, const double* values, double pivot_tol,
+                            Int* dropped);
+    Int rows(Int s) const { return rows_start_[s+1] - rows_start_[s]; }
+    Int cols(Int s) const { return super_start_[s+1] - super_start_[s]; }
+
+    Int dim_{0};
+    Int num_super_{0};
+    bool analyzed_{false};
+    bool factorized_{false};
+    Int dropped_pivots_{0};
+
+    std::vector<Int> perm_;         // perm_[k] = original index of column k
+    std::vector<Int> super_start_;  // columns of supernode s
+    std::vector<Int> super_parent_; // -1 for a root
+    std::vector<Int> first_desc_;   // first supernode in the subtree of s
+    std::vector<double> subtree_work_;
+    std::vector<Int> child_start_;
+    std::vector<Int> child_;
+    std::vector<Int> rows_start_;   // row indices of supernode s; the first
+    std::vector<Int> rows_;         // cols(s) entries are its columns
+
+    // Entries of the input matrix and their position in the frontal matrix.
+    std::vector<Int> assemble_start_;
+    std::vector<Int> assemble_src_;
+    std::vector<std::size_t> assemble_dst_;
+    std::vector<Int> diag_src_;     // position of M[k,k] for permuted k
+    // For the update matrix of each supernode, the positions of its rows in
+    // the frontal matrix of the parent.
+    std::vector<Int> relind_start_;
+    std::vector<Int> relind_;
+
+    // Columns of L of supernode s, stored as a dense rows(s) by cols(s)
+    // matrix in column major order.
+    std::vector<std::size_t> factor_start_;
+    std::vector<double> factor_;
+    std::vector<std::vector<double>> update_;
+};
+
+}  // namespace ipx
+
+#endif  // IPX_SPARSE_CHOLESKY_H_
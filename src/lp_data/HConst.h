@@ -36,8 +36,6 @@ const std::string kHighsOnString = "on";
 const HighsInt kSimplexConcurrencyLimit = 8;
 const double kRunningAverageMultiplier = 0.05;
 
-const bool kExtendInvertWhenAddingRows = false;
-
 enum SimplexScaleStrategy {
   kSimplexScaleStrategyMin = 0,
   kSimplexScaleStrategyOff = kSimplexScaleStrategyMin,  // 0
@@ -22,6 +22,7 @@
 #include <sstream>
 
 #include "io/Filereader.h"
+#include "io/FilereaderHbin.h"
 #include "io/LoadOptions.h"
 #include "lp_data/HighsInfoDebug.h"
 #include "lp_data/HighsLpSolverObject.h"
@@ -65,6 +66,7 @@ HighsStatus Highs::clearSolver() {
   HighsStatus return_status = HighsStatus::kOk;
   clearPresolve();
   invalidateUserSolverData();
+  mip_warm_start_.clear();
   return returnFromHighs(return_status);
 }
 
@@ -517,6 +519,14 @@ HighsStatus Highs::readModel(const std::string& filename) {
   HighsModel model;
   FilereaderRetcode call_code =
       reader->readModelFromFile(options_, filename, model);
+  // A .hbin file may also hold a basis and solution for the model
+  HighsBasis read_basis;
+  HighsSolution read_solution;
+  FilereaderHbin* hbin_reader = dynamic_cast<FilereaderHbin*>(reader);
+  if (hbin_reader && call_code == FilereaderRetcode::kOk) {
+    read_basis = std::move(hbin_reader->basis);
+    read_solution = std::move(hbin_reader->solution);
+  }
   delete reader;
   if (call_code != FilereaderRetcode::kOk) {
     interpretFilereaderRetcode(options_.log_options, filename.c_str(),
@@ -540,6 +550,15 @@ HighsStatus Highs::readModel(const std::string& filename) {
   return_status =
       interpretCallStatus(options_.log_options, passModel(std::move(model)),
                           return_status, "passModel");
+  if (return_status == HighsStatus::kError) return return_status;
+  if (read_solution.value_valid || read_solution.dual_valid)
+    return_status = interpretCallStatus(options_.log_options,
+                                        setSolution(read_solution),
+                                        return_status, "setSolution");
+  if (read_basis.valid && return_status != HighsStatus::kError)
+    return_status = interpretCallStatus(options_.log_options,
+                                        setBasis(read_basis, "readModel"),
+                                        return_status, "setBasis");
   return returnFromHighs(return_status);
 }
 
@@ -585,6 +604,9 @@ HighsStatus Highs::writeModel(const std::string& filename) {
                    "Model file %s not supported\n", filename.c_str());
       return HighsStatus::kError;
     }
+    // A .hbin file also holds any basis and solution
+    FilereaderHbin* hbin_writer = dynamic_cast<FilereaderHbin*>(writer);
+    if (hbin_writer) hbin_writer->setWarmStart(&basis_, &solution_);
     // Report to user that model is being written
     highsLogUser(options_.log_options, HighsLogType::kInfo,
                  "Writing the model to %s\n", filename.c_str());
@@ -2973,8 +2995,32 @@ HighsStatus Highs::callSolveMip() {
                                   options_.primal_feasibility_tolerance);
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
+  // Search data from the previous solve of this model can be reused after
+  // changes to bounds and costs. The previous incumbent is only used as MIP
+  // start if it is still feasible.
+  const bool keep_search_data =
+      options_.mip_keep_search_data && !has_semi_variables;
+  const bool use_warm_start =
+      keep_search_data && mip_warm_start_.matches(lp.num_col_, lp.num_row_);
+  std::vector<double> warm_start_row_value;
+  if (use_warm_start && !user_solution &&
+      mip_warm_start_.feasibleSolution(lp, options_.mip_feasibility_tolerance,
+                                       warm_start_row_value)) {
+    solution_.col_value = mip_warm_start_.solution;
+    solution_.row_value = std::move(warm_start_row_value);
+    solution_.value_valid = true;
+  }
   HighsMipSolver solver(options_, lp, solution_);
+  if (use_warm_start) {
+    solver.pscostinit = &mip_warm_start_.pscostinit;
+    if (mip_warm_start_.root_basis.valid)
+      solver.rootbasis = &mip_warm_start_.root_basis;
+  }
   solver.run();
+  if (keep_search_data)
+    solver.saveWarmStart(mip_warm_start_);
+  else
+    mip_warm_start_.clear();
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
   // model status
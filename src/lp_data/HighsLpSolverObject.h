@@ -16,6 +16,8 @@
 #ifndef LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
 #define LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
 
+#include <atomic>
+
 #include "lp_data/HighsInfo.h"
 #include "lp_data/HighsOptions.h"
 #include "simplex/HEkk.h"
@@ -42,6 +44,8 @@ class HighsLpSolverObject {
   HighsTimer& timer_;
 
   HighsModelStatus model_status_ = HighsModelStatus::kNotset;
+  // If set, the solvers stop when the flag becomes true
+  const std::atomic<bool>* interrupt_flag_ = nullptr;
 };
 
 #endif  // LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
@@ -70,12 +70,14 @@ bool commandLineOffChooseOnOk(const HighsLogOptions& report_log_options,
 bool commandLineSolverOk(const HighsLogOptions& report_log_options,
                          const string& value) {
   if (value == kSimplexString || value == kHighsChooseString ||
-      value == kIpmString)
+      value == kIpmString || value == kConcurrentString)
     return true;
   highsLogUser(report_log_options, HighsLogType::kWarning,
-               "Value \"%s\" is not one of \"%s\", \"%s\" or \"%s\"\n",
+               "Value \"%s\" is not one of \"%s\", \"%s\", \"%s\" or "
+               "\"%s\"\n",
                value.c_str(), kSimplexString.c_str(),
-               kHighsChooseString.c_str(), kIpmString.c_str());
+               kHighsChooseString.c_str(), kIpmString.c_str(),
+               kConcurrentString.c_str());
   return false;
 }
 
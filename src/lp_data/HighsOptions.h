@@ -244,6 +244,7 @@ void reportOption(FILE* file, const OptionRecordString& option,
 
 const string kSimplexString = "simplex";
 const string kIpmString = "ipm";
+const string kConcurrentString = "concurrent";
 
 const HighsInt kKeepNRowsDeleteRows = -1;
 const HighsInt kKeepNRowsDeleteEntries = 0;
@@ -301,6 +302,8 @@ struct HighsOptionsStruct {
   HighsInt simplex_update_limit;
   HighsInt simplex_min_concurrency;
   HighsInt simplex_max_concurrency;
+  bool simplex_parallel_solve;
+  bool simplex_parallel_factor;
 
   std::string log_file;
   bool write_model_to_file;
@@ -314,6 +317,7 @@ struct HighsOptionsStruct {
 
   // Options for IPM solver
   HighsInt ipm_iteration_limit;
+  HighsInt ipm_kkt_solver;
 
   // Advanced options
   HighsInt log_dev_level;
@@ -344,9 +348,12 @@ struct HighsOptionsStruct {
   double dual_simplex_cost_perturbation_multiplier;
   double primal_simplex_bound_perturbation_multiplier;
   double dual_simplex_pivot_growth_tolerance;
+  bool dual_simplex_chuzr_heap;
   double presolve_pivot_threshold;
   double factor_pivot_threshold;
   double factor_pivot_tolerance;
+  bool factor_dense_kernel;
+  bool extend_invert_when_adding_rows;
   double start_crossover_tolerance;
   bool less_infeasible_DSE_check;
   bool less_infeasible_DSE_choose_row;
@@ -364,6 +371,10 @@ struct HighsOptionsStruct {
 
   // Options for MIP solver
   bool mip_detect_symmetry;
+  bool mip_subtree_submips;
+  bool mip_parallel_deterministic;
+  bool mip_background_heuristics;
+  bool mip_keep_search_data;
   HighsInt mip_max_nodes;
   HighsInt mip_max_stall_nodes;
   HighsInt mip_max_leaves;
@@ -373,6 +384,8 @@ struct HighsOptionsStruct {
   HighsInt mip_pool_soft_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
+  HighsInt mip_min_cutpool_rows_for_parallelism;
+  HighsInt mip_lazy_propagation_row_length;
   HighsInt mip_report_level;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
@@ -452,9 +465,11 @@ class HighsOptions : public HighsOptionsStruct {
 
     record_string = new OptionRecordString(
         kSolverString,
-        "Solver option: \"simplex\", \"choose\" or \"ipm\". If "
-        "\"simplex\"/\"ipm\" is chosen then, for a MIP (QP) the integrality "
-        "constraint (quadratic term) will be ignored",
+        "Solver option: \"simplex\", \"choose\", \"ipm\" or \"concurrent\". "
+        "If \"simplex\"/\"ipm\"/\"concurrent\" is chosen then, for a MIP "
+        "(QP) the integrality constraint (quadratic term) will be ignored. "
+        "With \"concurrent\", dual simplex, primal simplex and IPM race on "
+        "separate threads and the first to finish stops the others",
         advanced, &solver, kHighsChooseString);
     records.push_back(record_string);
 
@@ -623,6 +638,20 @@ class HighsOptions : public HighsOptionsStruct {
                             kSimplexConcurrencyLimit, kSimplexConcurrencyLimit);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "simplex_parallel_solve",
+        "Use level scheduled parallel triangular solves with the simplex "
+        "basis factors when the RHS is dense",
+        advanced, &simplex_parallel_solve, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "simplex_parallel_factor",
+        "Eliminate large kernel pivots in parallel when factorizing the "
+        "simplex basis matrix",
+        advanced, &simplex_parallel_factor, false);
+    records.push_back(record_bool);
+
     record_bool =
         new OptionRecordBool("output_flag", "Enables or disables solver output",
                              advanced, &output_flag, true);
@@ -722,6 +751,39 @@ class HighsOptions : public HighsOptionsStruct {
                                        advanced, &mip_detect_symmetry, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "mip_subtree_submips",
+        "Whether the most promising open subtrees of the MIP search are "
+        "solved as independent sub-MIPs on concurrent threads when more than "
+        "one thread is available",
+        advanced, &mip_subtree_submips, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_parallel_deterministic",
+        "Whether subtree sub-MIPs exchange incumbents only at barriers and "
+        "are limited by deterministic work units, and background heuristics "
+        "are not used, so that runs with the same number of threads are "
+        "reproducible",
+        advanced, &mip_parallel_deterministic, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_background_heuristics",
+        "Whether sub-MIPs of primal heuristics at the root node and in the "
+        "tree search are solved as background tasks when more than one "
+        "thread is available",
+        advanced, &mip_background_heuristics, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_keep_search_data",
+        "Whether pseudocosts, the root basis and the incumbent of a MIP solve "
+        "are kept to warm-start the next solve after changes to bounds or "
+        "costs",
+        advanced, &mip_keep_search_data, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt("mip_max_nodes",
                                      "MIP solver max number of nodes", advanced,
                                      &mip_max_nodes, 0, kHighsIInf, kHighsIInf);
@@ -782,11 +844,26 @@ class HighsOptions : public HighsOptionsStruct {
     record_int = new OptionRecordInt(
         "mip_min_cliquetable_entries_for_parallelism",
         "minimal number of entries in the cliquetable before neighborhood "
-        "queries of the conflict graph use parallel processing",
+        "queries of the conflict graph use parallel processing and clique "
+        "separation searches subtrees in parallel",
         advanced, &mip_min_cliquetable_entries_for_parallelism, 0, 100000,
         kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_min_cutpool_rows_for_parallelism",
+        "minimal number of rows in the cut pool before the cuts are evaluated "
+        "in parallel during cut pool separation",
+        advanced, &mip_min_cutpool_rows_for_parallelism, 0, 2000, kHighsIInf);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "mip_lazy_propagation_row_length",
+        "minimal length of model rows whose propagation only scans the entries "
+        "that can change a bound given the slack of the row",
+        advanced, &mip_lazy_propagation_row_length, 1, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
     record_int =
         new OptionRecordInt("mip_report_level", "MIP solver reporting level",
                             advanced, &mip_report_level, 0, 1, 2);
@@ -821,6 +898,14 @@ class HighsOptions : public HighsOptionsStruct {
         &ipm_iteration_limit, 0, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "ipm_kkt_solver",
+        "Linear solver for the IPM normal equations: 0 => conjugate "
+        "residuals with diagonal and basis preconditioning; 1 => sparse "
+        "Cholesky factorization",
+        advanced, &ipm_kkt_solver, 0, 0, 1);
+    records.push_back(record_int);
+
     // Advanced options
     advanced = true;
 
@@ -984,6 +1069,13 @@ class HighsOptions : public HighsOptionsStruct {
         &dual_simplex_pivot_growth_tolerance, 1e-12, 1e-9, kHighsInf);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "dual_simplex_chuzr_heap",
+        "Choose the leaving row in the dual simplex method using a max-heap "
+        "of the weighted primal infeasibilities",
+        advanced, &dual_simplex_chuzr_heap, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "presolve_pivot_threshold",
         "Matrix factorization pivot threshold for substitutions in presolve",
@@ -1019,6 +1111,20 @@ class HighsOptions : public HighsOptionsStruct {
         kDefaultPivotTolerance, kMaxPivotTolerance);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "factor_dense_kernel",
+        "Use dense LU for the remaining kernel of the matrix when it becomes "
+        "dense in matrix factorization",
+        advanced, &factor_dense_kernel, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "extend_invert_when_adding_rows",
+        "Extend the matrix factorization when rows are added to the LP, "
+        "with their slacks basic, rather than reinverting",
+        advanced, &extend_invert_when_adding_rows, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "start_crossover_tolerance",
         "Tolerance to be satisfied before IPM crossover will start", advanced,
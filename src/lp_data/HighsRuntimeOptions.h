@@ -48,8 +48,8 @@ bool loadOptions(const HighsLogOptions& report_log_options, int argc,
          cxxopts::value<std::string>())
         // solver option
         (kSolverString,
-         "Solver: \"choose\" by default - \"simplex\"/\"ipm\" are "
-         "alternatives.",
+         "Solver: \"choose\" by default - \"simplex\"/\"ipm\"/"
+         "\"concurrent\" are alternatives.",
          cxxopts::value<std::string>())
         // parallel option
         (kParallelString,
@@ -14,8 +14,12 @@
  * @brief Class-independent utilities for HiGHS
  */
 
+#include <array>
+#include <atomic>
+
 #include "ipm/IpxWrapper.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HApp.h"
 
 // The method below runs simplex or ipx solver on the lp.
@@ -45,6 +49,16 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
     return_status = interpretCallStatus(options.log_options, call_status,
                                         return_status, "solveUnconstrainedLp");
     if (return_status == HighsStatus::kError) return return_status;
+  } else if (options.solver == kConcurrentString &&
+             !solver_object.basis_.valid &&
+             !solver_object.ekk_instance_.status_.has_basis &&
+             highs::parallel::num_threads() > 1) {
+    // Race the LP solvers, unless there is a basis to warm-start
+    // simplex or no thread to race on
+    call_status = solveLpConcurrent(solver_object);
+    return_status = interpretCallStatus(options.log_options, call_status,
+                                        return_status, "solveLpConcurrent");
+    if (return_status == HighsStatus::kError) return return_status;
   } else if (options.solver == kIpmString) {
     // Use IPM
     bool imprecise_solution;
@@ -126,6 +140,109 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
   return return_status;
 }
 
+// Runs dual simplex, primal simplex and IPX concurrently, each on its
+// own copy of the LP. The first to reach a conclusive model status
+// interrupts the others, and its results are returned in solver_object
+HighsStatus solveLpConcurrent(HighsLpSolverObject& solver_object) {
+  HighsOptions& options = solver_object.options_;
+  struct ConcurrentLpSolve {
+    ConcurrentLpSolve(const HighsLpSolverObject& solver_object)
+        : lp(solver_object.lp_),
+          basis(solver_object.basis_),
+          solution(solver_object.solution_),
+          highs_info(solver_object.highs_info_),
+          options(solver_object.options_),
+          timer(solver_object.timer_) {}
+    HighsLp lp;
+    HighsBasis basis;
+    HighsSolution solution;
+    HighsInfo highs_info;
+    HEkk ekk_instance;
+    HighsOptions options;
+    HighsTimer timer;
+    HighsModelStatus model_status = HighsModelStatus::kNotset;
+    HighsStatus return_status = HighsStatus::kError;
+  };
+  // Primal simplex is generally the slowest, so is last in case the
+  // solvers have to share threads
+  const HighsInt kNumConcurrentSolve = 3;
+  const std::array<std::string, kNumConcurrentSolve> solve_name = {
+      "dual simplex", "IPM", "primal simplex"};
+  std::vector<ConcurrentLpSolve> solve;
+  solve.reserve(kNumConcurrentSolve);
+  for (HighsInt iSolve = 0; iSolve < kNumConcurrentSolve; iSolve++) {
+    solve.emplace_back(solver_object);
+    ConcurrentLpSolve& this_solve = solve.back();
+    // Logging from concurrent solvers would be interleaved
+    this_solve.options.output_flag = false;
+    if (iSolve == 1) {
+      this_solve.options.solver = kIpmString;
+    } else {
+      this_solve.options.solver = kSimplexString;
+      this_solve.options.simplex_strategy =
+          iSolve == 0 ? kSimplexStrategyDual : kSimplexStrategyPrimal;
+    }
+  }
+
+  std::atomic<bool> interrupt{false};
+  std::atomic<HighsInt> winner{-1};
+  highs::parallel::for_each(
+      0, kNumConcurrentSolve,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt iSolve = start; iSolve < end; iSolve++) {
+          ConcurrentLpSolve& this_solve = solve[iSolve];
+          HighsLpSolverObject this_solver_object(
+              this_solve.lp, this_solve.basis, this_solve.solution,
+              this_solve.highs_info, this_solve.ekk_instance,
+              this_solve.options, this_solve.timer);
+          this_solver_object.interrupt_flag_ = &interrupt;
+          try {
+            this_solve.return_status =
+                solveLp(this_solver_object, "Solving LP with " +
+                                                solve_name[iSolve]);
+          } catch (const std::exception& exception) {
+            highsLogDev(options.log_options, HighsLogType::kError,
+                        "Exception %s in concurrent %s\n", exception.what(),
+                        solve_name[iSolve].c_str());
+            this_solve.return_status = HighsStatus::kError;
+          }
+          this_solve.model_status = this_solver_object.model_status_;
+          if (this_solve.return_status == HighsStatus::kError) continue;
+          // Only a model status that is not due to a limit ends the race
+          switch (this_solve.model_status) {
+            case HighsModelStatus::kOptimal:
+            case HighsModelStatus::kInfeasible:
+            case HighsModelStatus::kUnboundedOrInfeasible:
+            case HighsModelStatus::kUnbounded:
+            case HighsModelStatus::kObjectiveBound:
+            case HighsModelStatus::kObjectiveTarget: {
+              HighsInt no_winner = -1;
+              if (winner.compare_exchange_strong(no_winner, iSolve))
+                interrupt.store(true, std::memory_order_relaxed);
+              break;
+            }
+            default:
+              break;
+          }
+        }
+      },
+      1);
+
+  // If no solver reached a conclusive model status, return the
+  // outcome of dual simplex
+  const HighsInt use_solve = winner >= 0 ? HighsInt(winner) : 0;
+  ConcurrentLpSolve& this_solve = solve[use_solve];
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent LP solve: %s returned model status %s\n",
+               solve_name[use_solve].c_str(),
+               utilModelStatusToString(this_solve.model_status).c_str());
+  solver_object.basis_ = std::move(this_solve.basis);
+  solver_object.solution_ = std::move(this_solve.solution);
+  solver_object.highs_info_ = std::move(this_solve.highs_info);
+  solver_object.model_status_ = this_solve.model_status;
+  return this_solve.return_status;
+}
+
 // Solves an unconstrained LP without scaling, setting HighsBasis, HighsSolution
 // and HighsInfo
 HighsStatus solveUnconstrainedLp(HighsLpSolverObject& solver_object) {
@@ -273,6 +273,159 @@ void HighsCliqueTable::bronKerboschRecurse(BronKerboschData& data,
   }
 }
 
+void HighsCliqueTable::bronKerboschParallel(BronKerboschData& data) const {
+  // The first level of the recursion has no excluded vertices. The subtree
+  // of each branching vertex is searched with its own data, where the
+  // branching vertices before it are excluded, as in the serial recursion.
+  // The subtrees are searched in waves of one branch per thread. After each
+  // wave the results are merged in the order of the branching vertices and
+  // the next wave starts from the best weight found so far, so the result
+  // does not depend on the scheduling of the tasks. Unlike in the serial
+  // recursion, the branches of one wave do not see the cliques found by the
+  // branches before them in the same wave, so the separated cliques can
+  // differ from the serial ones.
+  const HighsInt Plen = data.P.size();
+  double w = data.wR;
+  for (HighsInt i = 0; i != Plen; ++i) w += data.P[i].weight(data.sol);
+
+  if (w < data.minW - data.feastol) return;
+
+  ++data.ncalls;
+
+  if (data.stop()) return;
+
+  double pivweight = -1.0;
+  CliqueVar pivot;
+  for (HighsInt i = 0; i != Plen; ++i) {
+    if (data.P[i].weight(data.sol) > pivweight) {
+      pivweight = data.P[i].weight(data.sol);
+      pivot = data.P[i];
+      if (pivweight >= 1.0 - data.feastol) break;
+    }
+  }
+
+  std::vector<CliqueVar> PminusNu;
+  PminusNu.reserve(Plen);
+  queryNeighborhood(data.neighborhoodInds, data.numNeighborhoodQueries, pivot,
+                    data.P.data(), Plen);
+  data.neighborhoodInds.push_back(Plen);
+  HighsInt k = 0;
+  for (HighsInt i : data.neighborhoodInds) {
+    while (k < i) PminusNu.push_back(data.P[k++]);
+    ++k;
+  }
+
+  pdqsort(PminusNu.begin(), PminusNu.end(), [&](CliqueVar a, CliqueVar b) {
+    return std::make_pair(a.weight(data.sol), a.index()) >
+           std::make_pair(b.weight(data.sol), b.index());
+  });
+
+  const HighsInt numBranches = PminusNu.size();
+  std::vector<HighsInt> branchPos(numcliquesvar.size(), numBranches);
+  for (HighsInt b = 0; b != numBranches; ++b)
+    branchPos[PminusNu[b].index()] = b;
+
+  const HighsInt waveSize = highs::parallel::num_threads();
+  std::vector<BronKerboschData> branches;
+  branches.reserve(waveSize);
+  for (HighsInt waveStart = 0; waveStart < numBranches;) {
+    // the weight of P without the branching vertices already searched bounds
+    // the weight of the cliques in the remaining subtrees
+    if (waveStart != 0 && w < data.minW) return;
+
+    // the remaining calls and neighborhood queries are shared by the
+    // subtrees of this wave, so that the heaviest subtrees get most of the
+    // budget as in the serial recursion, and whatever they leave is passed
+    // on to the next wave. The total never exceeds the serial budget
+    HighsInt waveEnd = std::min(numBranches, waveStart + waveSize);
+    const HighsInt numWaveBranches = waveEnd - waveStart;
+    const HighsInt remainingCalls = data.maxcalls - data.ncalls;
+    const int64_t remainingQueries =
+        data.maxNeighborhoodQueries - data.numNeighborhoodQueries;
+
+    double wBranch = w;
+    branches.clear();
+    for (HighsInt b = waveStart; b != waveEnd; ++b) {
+      if (b != waveStart) {
+        wBranch -= PminusNu[b - 1].weight(data.sol);
+        if (wBranch < data.minW) break;
+      }
+      const HighsInt i = b - waveStart;
+      const HighsInt maxcalls = remainingCalls / numWaveBranches +
+                                (i < remainingCalls % numWaveBranches);
+      if (maxcalls == 0) break;
+
+      branches.emplace_back(data.sol);
+      BronKerboschData& branch = branches.back();
+      branch.minW = data.minW;
+      branch.feastol = data.feastol;
+      branch.maxcalls = maxcalls;
+      branch.maxcliques = data.maxcliques - data.cliques.size();
+      branch.maxNeighborhoodQueries =
+          remainingQueries / numWaveBranches +
+          (i < remainingQueries % numWaveBranches);
+    }
+    if (branches.empty()) return;
+    waveEnd = waveStart + branches.size();
+
+    highs::parallel::for_each(
+        waveStart, waveEnd,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt b = start; b < end; ++b) {
+            BronKerboschData& branch = branches[b - waveStart];
+            CliqueVar v = PminusNu[b];
+
+            branch.P.reserve(Plen);
+            for (HighsInt i = 0; i != Plen; ++i)
+              if (branchPos[data.P[i].index()] > b)
+                branch.P.push_back(data.P[i]);
+            std::vector<CliqueVar> X(PminusNu.begin(), PminusNu.begin() + b);
+
+            HighsInt newPlen = partitionNeighborhood(
+                branch.neighborhoodInds, branch.numNeighborhoodQueries, v,
+                branch.P.data(), branch.P.size());
+            HighsInt newXlen = partitionNeighborhood(
+                branch.neighborhoodInds, branch.numNeighborhoodQueries, v,
+                X.data(), X.size());
+
+            branch.R.push_back(v);
+            branch.wR = v.weight(data.sol);
+            bronKerboschRecurse(branch, newPlen, X.data(), newXlen);
+          }
+        },
+        1);
+
+    // merge as the serial recursion would have recorded the cliques: a
+    // subtree that found more violated cliques replaces those found before,
+    // and cliques that are less violated than the best ones are dropped
+    for (HighsInt b = waveStart; b != waveEnd; ++b) {
+      BronKerboschData& branch = branches[b - waveStart];
+      data.ncalls += branch.ncalls;
+      data.numNeighborhoodQueries += branch.numNeighborhoodQueries;
+      w -= PminusNu[b].weight(data.sol);
+      if (branch.cliques.empty()) continue;
+
+      // an earlier branch of this wave may have found more violated cliques
+      // than the ones of this branch, which are then dropped
+      if (branch.minW < data.minW - data.feastol) continue;
+
+      if (data.minW < branch.minW - data.feastol) {
+        data.maxcliques -= data.cliques.size();
+        data.cliques.clear();
+        data.minW = branch.minW;
+      }
+
+      for (std::vector<CliqueVar>& clique : branch.cliques) {
+        if (int(data.cliques.size()) >= data.maxcliques) break;
+        data.cliques.emplace_back(std::move(clique));
+      }
+    }
+
+    if (data.stop()) return;
+    waveStart = waveEnd;
+  }
+}
+
 #if 0
 static void printRow(const HighsDomain& domain, const HighsInt* inds,
                      const double* vals, HighsInt len, double lhs, double rhs) {
@@ -1711,7 +1864,11 @@ void HighsCliqueTable::separateCliques(const HighsMipSolver& mipsolver,
   }
 
   // auto t1 = std::chrono::high_resolution_clock::now();
-  bronKerboschRecurse(data, data.P.size(), nullptr, 0);
+  if (highs::parallel::num_threads() > 1 &&
+      numEntries - sizeTwoCliques.size() * 2 >= minEntriesForParallelism)
+    bronKerboschParallel(data);
+  else
+    bronKerboschRecurse(data, data.P.size(), nullptr, 0);
 
   // auto t2 = std::chrono::high_resolution_clock::now();
 
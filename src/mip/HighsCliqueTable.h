@@ -142,6 +142,8 @@ class HighsCliqueTable {
   void bronKerboschRecurse(BronKerboschData& data, HighsInt Plen,
                            const CliqueVar* X, HighsInt Xlen) const;
 
+  void bronKerboschParallel(BronKerboschData& data) const;
+
   void extractCliques(const HighsMipSolver& mipsolver,
                       std::vector<HighsInt>& inds, std::vector<double>& vals,
                       std::vector<int8_t>& complementation, double rhs,
@@ -19,10 +19,13 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsHash.h"
 
+static constexpr HighsInt kCutSeparationGrainSize = 500;
+
 static uint64_t compute_cut_hash(const HighsInt* Rindex, const double* Rvalue,
                                  double maxabscoef, const HighsInt Rlen) {
   std::vector<uint32_t> valueHashCodes(Rlen);
@@ -188,21 +191,72 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
     --agelim;
   }
 
+  // the violation and score of each cut only depend on the cut itself, so
+  // they are computed for all cuts first and in parallel for large pools
+  cutViolation_.resize(nrows);
+  cutScore_.resize(nrows);
+  auto evaluateCuts = [&](HighsInt startRow, HighsInt endRow) {
+    for (HighsInt i = startRow; i < endRow; ++i) {
+      // cuts with an age of -1 are already in the LP and are therefore skipped
+      if (ages_[i] < 0) continue;
+
+      HighsInt start = matrix_.getRowStart(i);
+      HighsInt end = matrix_.getRowEnd(i);
+
+      double viol(-rhs_[i]);
+
+      for (HighsInt j = start; j != end; ++j) {
+        HighsInt col = ARindex[j];
+        double solval = sol[col];
+
+        viol += ARvalue[j] * solval;
+      }
+
+      cutViolation_[i] = viol;
+      if (viol <= feastol) continue;
+
+      // compute the norm only for those entries that do not sit at their
+      // minimal activity in the current solution this avoids the phenomenon
+      // that the traditional efficacy gets weaker for stronger cuts E.g. when
+      // considering a clique cut which has additional entries whose value in
+      // the current solution is 0 then the efficacy gets lower for each such
+      // entry even though the cut dominates the clique cut where all those
+      // entries are relaxed out.
+      HighsCDouble rownorm = 0.0;
+      HighsInt numActiveNzs = 0;
+      for (HighsInt j = start; j != end; ++j) {
+        HighsInt col = ARindex[j];
+        double solval = sol[col];
+        if (ARvalue[j] > 0) {
+          if (solval > domain.col_lower_[col] + feastol) {
+            rownorm += ARvalue[j] * ARvalue[j];
+            numActiveNzs += 1;
+          }
+        } else {
+          if (solval < domain.col_upper_[col] - feastol) {
+            rownorm += ARvalue[j] * ARvalue[j];
+            numActiveNzs += 1;
+          }
+        }
+      }
+
+      cutScore_[i] = viol / (numActiveNzs * sqrt(double(rownorm)));
+    }
+  };
+
+  if (nrows >= minCutsForParallelism)
+    highs::parallel::for_each(0, nrows, evaluateCuts,
+                              kCutSeparationGrainSize);
+  else
+    evaluateCuts(0, nrows);
+
   for (HighsInt i = 0; i < nrows; ++i) {
-    // cuts with an age of -1 are already in the LP and are therefore skipped
     if (ages_[i] < 0) continue;
 
     HighsInt start = matrix_.getRowStart(i);
     HighsInt end = matrix_.getRowEnd(i);
 
-    double viol(-rhs_[i]);
-
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = ARindex[j];
-      double solval = sol[col];
-
-      viol += ARvalue[j] * solval;
-    }
+    double viol = cutViolation_[i];
 
     // if the cut is not violated more than feasibility tolerance
     // we skip it and increase its age, otherwise we reset its age
@@ -242,37 +296,11 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
       continue;
     }
 
-    // compute the norm only for those entries that do not sit at their minimal
-    // activity in the current solution this avoids the phenomenon that the
-    // traditional efficacy gets weaker for stronger cuts E.g. when considering
-    // a clique cut which has additional entries whose value in the current
-    // solution is 0 then the efficacy gets lower for each such entry even
-    // though the cut dominates the clique cut where all those entries are
-    // relaxed out.
-    HighsCDouble rownorm = 0.0;
-    HighsInt numActiveNzs = 0;
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = ARindex[j];
-      double solval = sol[col];
-      if (ARvalue[j] > 0) {
-        if (solval > domain.col_lower_[col] + feastol) {
-          rownorm += ARvalue[j] * ARvalue[j];
-          numActiveNzs += 1;
-        }
-      } else {
-        if (solval < domain.col_upper_[col] - feastol) {
-          rownorm += ARvalue[j] * ARvalue[j];
-          numActiveNzs += 1;
-        }
-      }
-    }
-
     ages_[i] = 0;
     ++ageDistribution[0];
     if (isPropagated) propRows.emplace(ages_[i], i);
-    double score = viol / (numActiveNzs * sqrt(double(rownorm)));
 
-    efficacious_cuts.emplace_back(score, i);
+    efficacious_cuts.emplace_back(cutScore_[i], i);
   }
   assert((HighsInt)propRows.size() == numPropRows);
   if (efficacious_cuts.empty()) return;
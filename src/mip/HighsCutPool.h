@@ -74,8 +74,11 @@ class HighsCutPool {
   HighsInt numLpCuts;
   HighsInt numPropNzs;
   HighsInt numPropRows;
+  HighsInt minCutsForParallelism;
   std::vector<HighsInt> ageDistribution;
   std::vector<std::pair<HighsInt, double>> sortBuffer;
+  std::vector<double> cutViolation_;
+  std::vector<double> cutScore_;
 
   bool isDuplicate(size_t hash, double norm, const HighsInt* Rindex,
                    const double* Rvalue, HighsInt Rlen, double rhs);
@@ -87,7 +90,8 @@ class HighsCutPool {
         softlimit_(softlimit),
         numLpCuts(0),
         numPropNzs(0),
-        numPropRows(0) {
+        numPropRows(0),
+        minCutsForParallelism(kHighsIInf) {
     ageDistribution.resize(agelim_ + 1);
     minScoreFactor = 0.9;
     bestObservedScore = 0.0;
@@ -133,6 +137,10 @@ class HighsCutPool {
     ageDistribution.resize(agelim_ + 1);
   }
 
+  void setMinCutsForParallelism(HighsInt minCutsForParallelism) {
+    this->minCutsForParallelism = minCutsForParallelism;
+  }
+
   void separate(const std::vector<double>& sol, HighsDomain& domprop,
                 HighsCutSet& cutset, double feastol);
 
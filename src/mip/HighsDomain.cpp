@@ -1446,11 +1446,19 @@ HighsInt HighsDomain::propagateRowUpper(const HighsInt* Rindex,
                                         double Rupper,
                                         const HighsCDouble& minactivity,
                                         HighsInt ninfmin,
-                                        HighsDomainChange* boundchgs) {
+                                        HighsDomainChange* boundchgs,
+                                        const double* Rrange) {
   assert(std::isfinite(double(minactivity)));
   if (ninfmin > 1) return 0;
   HighsInt numchgs = 0;
+  const double slack =
+      double(Rupper - minactivity) - mipsolver->mipdata_->feastol;
   for (HighsInt i = 0; i != Rlen; ++i) {
+    // only entries with an infinite bound can be tightened if there is one
+    // infinite contribution, which come first in the sorted order
+    if (Rrange != nullptr &&
+        (ninfmin == 1 ? Rrange[i] != kHighsInf : Rrange[i] <= slack))
+      break;
     HighsCDouble minresact;
     double actcontribution = activityContributionMin(
         Rvalue[i], col_lower_[Rindex[i]], col_upper_[Rindex[i]]);
@@ -1490,11 +1498,17 @@ HighsInt HighsDomain::propagateRowLower(const HighsInt* Rindex,
                                         double Rlower,
                                         const HighsCDouble& maxactivity,
                                         HighsInt ninfmax,
-                                        HighsDomainChange* boundchgs) {
+                                        HighsDomainChange* boundchgs,
+                                        const double* Rrange) {
   assert(std::isfinite(double(maxactivity)));
   if (ninfmax > 1) return 0;
   HighsInt numchgs = 0;
+  const double slack =
+      double(maxactivity - Rlower) - mipsolver->mipdata_->feastol;
   for (HighsInt i = 0; i != Rlen; ++i) {
+    if (Rrange != nullptr &&
+        (ninfmax == 1 ? Rrange[i] != kHighsInf : Rrange[i] <= slack))
+      break;
     HighsCDouble maxresact;
     double actcontribution = activityContributionMax(
         Rvalue[i], col_lower_[Rindex[i]], col_upper_[Rindex[i]]);
@@ -1917,6 +1931,33 @@ void HighsDomain::recomputeCapacityThreshold(HighsInt row) {
   HighsInt end = mipsolver->mipdata_->ARstart_[row + 1];
 
   capacityThreshold_[row] = -feastol();
+  if (mipsolver->mipdata_->lazyPropagationRow(row)) {
+    // the entries are sorted by their maximal activity change, which bounds
+    // the threshold of all remaining entries
+    const HighsInt* ARindex = mipsolver->mipdata_->ARpropIndex_.data();
+    const double* ARvalue = mipsolver->mipdata_->ARpropValue_.data();
+    const double* ARrange = mipsolver->mipdata_->ARpropRange_.data();
+    for (HighsInt i = start; i < end; ++i) {
+      if (ARrange[i] <= capacityThreshold_[row]) break;
+
+      HighsInt col = ARindex[i];
+
+      if (col_upper_[col] == col_lower_[col]) continue;
+
+      double boundRange = col_upper_[col] - col_lower_[col];
+
+      boundRange -= variableType(col) == HighsVarType::kContinuous
+                        ? std::max(0.3 * boundRange, 1000.0 * feastol())
+                        : feastol();
+
+      double threshold = std::fabs(ARvalue[i]) * boundRange;
+
+      capacityThreshold_[row] =
+          std::max({capacityThreshold_[row], threshold, feastol()});
+    }
+    return;
+  }
+
   for (HighsInt i = start; i < end; ++i) {
     HighsInt col = mipsolver->mipdata_->ARindex_[i];
 
@@ -2425,9 +2466,10 @@ bool HighsDomain::propagate() {
       for (HighsInt i = 0; i != numproprows; ++i) {
         HighsInt row = propagateinds[i];
         propagateflags_[row] = 0;
-        propnnz += mipsolver->mipdata_->ARstart_[i + 1] -
-                   mipsolver->mipdata_->ARstart_[i];
+        propnnz += mipsolver->mipdata_->ARstart_[row + 1] -
+                   mipsolver->mipdata_->ARstart_[row];
       }
+      mipsolver->mipdata_->propagation_work += propnnz;
 
       if (!infeasible_) {
         propRowNumChangedBounds_.assign(
@@ -2441,6 +2483,12 @@ bool HighsDomain::propagate() {
           HighsInt Rlen = end - start;
           const HighsInt* Rindex = mipsolver->mipdata_->ARindex_.data() + start;
           const double* Rvalue = mipsolver->mipdata_->ARvalue_.data() + start;
+          const double* Rrange = nullptr;
+          if (mipsolver->mipdata_->lazyPropagationRow(i)) {
+            Rindex = mipsolver->mipdata_->ARpropIndex_.data() + start;
+            Rvalue = mipsolver->mipdata_->ARpropValue_.data() + start;
+            Rrange = mipsolver->mipdata_->ARpropRange_.data() + start;
+          }
           bool recomputeCapThreshold = false;
 
           if (mipsolver->rowUpper(i) != kHighsInf &&
@@ -2453,7 +2501,7 @@ bool HighsDomain::propagate() {
             activitymin_[i].renormalize();
             propRowNumChangedBounds_[k].first = propagateRowUpper(
                 Rindex, Rvalue, Rlen, mipsolver->rowUpper(i), activitymin_[i],
-                activitymininf_[i], &changedbounds[2 * start]);
+                activitymininf_[i], &changedbounds[2 * start], Rrange);
 
             recomputeCapThreshold = true;
           }
@@ -2469,7 +2517,8 @@ bool HighsDomain::propagate() {
             propRowNumChangedBounds_[k].second = propagateRowLower(
                 Rindex, Rvalue, Rlen, mipsolver->rowLower(i), activitymax_[i],
                 activitymaxinf_[i],
-                &changedbounds[2 * start + propRowNumChangedBounds_[k].first]);
+                &changedbounds[2 * start + propRowNumChangedBounds_[k].first],
+                Rrange);
 
             recomputeCapThreshold = true;
           }
@@ -2522,6 +2571,7 @@ bool HighsDomain::propagate() {
           propnnz += cutpoolprop.cutpool->getMatrix().getRowEnd(cut) -
                      cutpoolprop.cutpool->getMatrix().getRowStart(cut);
         }
+        mipsolver->mipdata_->propagation_work += propnnz;
 
         if (!infeasible_) {
           propRowNumChangedBounds_.assign(
@@ -409,15 +409,20 @@ class HighsDomain {
 
   double adjustedLb(HighsInt col, HighsCDouble boundVal, bool& accept) const;
 
+  // if Rrange is given, the entries are sorted by their maximal activity
+  // change Rrange[i] and the scan stops at the first entry whose activity
+  // change cannot exceed the slack of the row
   HighsInt propagateRowUpper(const HighsInt* Rindex, const double* Rvalue,
                              HighsInt Rlen, double Rupper,
                              const HighsCDouble& minactivity, HighsInt ninfmin,
-                             HighsDomainChange* boundchgs);
+                             HighsDomainChange* boundchgs,
+                             const double* Rrange = nullptr);
 
   HighsInt propagateRowLower(const HighsInt* Rindex, const double* Rvalue,
                              HighsInt Rlen, double Rlower,
                              const HighsCDouble& maxactivity, HighsInt ninfmax,
-                             HighsDomainChange* boundchgs);
+                             HighsDomainChange* boundchgs,
+                             const double* Rrange = nullptr);
 
   const std::vector<HighsInt>& getChangedCols() const { return changedcols_; }
 
@@ -16,62 +16,86 @@
 #include "mip/HighsMipSolverData.h"
 #include "pdqsort/pdqsort.h"
 
-bool HighsImplications::computeImplications(HighsInt col, bool val) {
-  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
-  HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
-  globaldomain.propagate();
-  if (globaldomain.infeasible() || globaldomain.isFixed(col)) return true;
-  const auto& domchgstack = globaldomain.getDomainChangeStack();
-  const auto& domchgreason = globaldomain.getDomainChangeReason();
-  HighsInt changedend = globaldomain.getChangedCols().size();
+void HighsImplications::probeColumn(HighsDomain& domain, HighsInt col,
+                                    bool val, ProbeResult& probe) const {
+  assert(!domain.infeasible() && !domain.isFixed(col));
+  const auto& domchgstack = domain.getDomainChangeStack();
+  const auto& domchgreason = domain.getDomainChangeReason();
+  HighsInt changedend = domain.getChangedCols().size();
 
   HighsInt stackimplicstart = domchgstack.size() + 1;
-  HighsInt numImplications = -stackimplicstart;
+  probe.implics.clear();
+  probe.numImplications = 0;
   if (val)
-    globaldomain.changeBound(HighsBoundType::kLower, col, 1);
+    domain.changeBound(HighsBoundType::kLower, col, 1);
   else
-    globaldomain.changeBound(HighsBoundType::kUpper, col, 0);
-
-  if (globaldomain.infeasible()) {
-    globaldomain.backtrack();
-    globaldomain.clearChangedCols(changedend);
-    cliquetable.vertexInfeasible(globaldomain, col, val);
+    domain.changeBound(HighsBoundType::kUpper, col, 0);
 
-    return true;
-  }
+  if (!domain.infeasible()) domain.propagate();
 
-  globaldomain.propagate();
+  probe.infeasible = domain.infeasible();
+  if (!probe.infeasible) {
+    HighsInt stackimplicend = domchgstack.size();
+    probe.numImplications = stackimplicend - stackimplicstart;
+    probe.implics.reserve(probe.numImplications);
 
-  if (globaldomain.infeasible()) {
-    globaldomain.backtrack();
-    globaldomain.clearChangedCols(changedend);
+    HighsInt numEntries = mipsolver.mipdata_->cliquetable.getNumEntries();
+    HighsInt maxEntries = 100000 + mipsolver.numNonzero();
 
-    cliquetable.vertexInfeasible(globaldomain, col, val);
+    for (HighsInt i = stackimplicstart; i < stackimplicend; ++i) {
+      if (domchgreason[i].type == HighsDomain::Reason::kCliqueTable &&
+          ((domchgreason[i].index >> 1) == col || numEntries >= maxEntries))
+        continue;
 
-    return true;
+      probe.implics.push_back(domchgstack[i]);
+    }
   }
 
-  HighsInt stackimplicend = domchgstack.size();
-  numImplications += stackimplicend;
-  mipsolver.mipdata_->pseudocost.addInferenceObservation(col, numImplications,
-                                                         val);
+  domain.backtrack();
+  domain.clearChangedCols(changedend);
+}
 
-  std::vector<HighsDomainChange> implics;
-  implics.reserve(numImplications);
+bool HighsImplications::computeImplications(HighsInt col, bool val,
+                                            ProbeResult* probe) {
+  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
+  globaldomain.propagate();
+  if (globaldomain.infeasible() || globaldomain.isFixed(col)) return true;
 
-  HighsInt numEntries = mipsolver.mipdata_->cliquetable.getNumEntries();
-  HighsInt maxEntries = 100000 + mipsolver.numNonzero();
+  ProbeResult globalProbe;
+  if (probe == nullptr) {
+    probeColumn(globaldomain, col, val, globalProbe);
+    probe = &globalProbe;
+  }
 
-  for (HighsInt i = stackimplicstart; i < stackimplicend; ++i) {
-    if (domchgreason[i].type == HighsDomain::Reason::kCliqueTable &&
-        ((domchgreason[i].index >> 1) == col || numEntries >= maxEntries))
-      continue;
+  std::vector<HighsDomainChange>& implics = probe->implics;
+  if (!probe->infeasible) {
+    // a probe done on a copy of the global domain may predate bound changes
+    // found meanwhile, so drop implications that are no longer tightening. An
+    // implication that contradicts the global domain proves infeasibility.
+    auto redundant = std::remove_if(
+        implics.begin(), implics.end(), [&](const HighsDomainChange& domchg) {
+          if (domchg.boundtype == HighsBoundType::kLower) {
+            if (domchg.boundval > globaldomain.col_upper_[domchg.column] +
+                                      mipsolver.mipdata_->feastol)
+              probe->infeasible = true;
+            return domchg.boundval <= globaldomain.col_lower_[domchg.column];
+          }
+          if (domchg.boundval < globaldomain.col_lower_[domchg.column] -
+                                    mipsolver.mipdata_->feastol)
+            probe->infeasible = true;
+          return domchg.boundval >= globaldomain.col_upper_[domchg.column];
+        });
+    implics.erase(redundant, implics.end());
+  }
 
-    implics.push_back(domchgstack[i]);
+  if (probe->infeasible) {
+    cliquetable.vertexInfeasible(globaldomain, col, val);
+    return true;
   }
 
-  globaldomain.backtrack();
-  globaldomain.clearChangedCols(changedend);
+  mipsolver.mipdata_->pseudocost.addInferenceObservation(
+      col, probe->numImplications, val);
 
   // add the implications of binary variables to the clique table
   auto binstart = std::partition(implics.begin(), implics.end(),
@@ -278,20 +302,21 @@ std::pair<HighsInt, HighsImplications::VarBound> HighsImplications::getBestVlb(
   return bestVlb;
 }
 
-bool HighsImplications::runProbing(HighsInt col, HighsInt& numReductions) {
+bool HighsImplications::runProbing(HighsInt col, HighsInt& numReductions,
+                                   ProbeResult* probes) {
   HighsDomain& globaldomain = mipsolver.mipdata_->domain;
   if (globaldomain.isBinary(col) && !implicationsCached(col, 1) &&
       !implicationsCached(col, 0) &&
       mipsolver.mipdata_->cliquetable.getSubstitution(col) == nullptr) {
     bool infeasible;
 
-    infeasible = computeImplications(col, 1);
+    infeasible = computeImplications(col, 1, probes ? &probes[1] : nullptr);
     if (globaldomain.infeasible()) return true;
     if (infeasible) return true;
     if (mipsolver.mipdata_->cliquetable.getSubstitution(col) != nullptr)
       return true;
 
-    infeasible = computeImplications(col, 0);
+    infeasible = computeImplications(col, 0, probes ? &probes[0] : nullptr);
     if (globaldomain.infeasible()) return true;
     if (infeasible) return true;
     if (mipsolver.mipdata_->cliquetable.getSubstitution(col) != nullptr)
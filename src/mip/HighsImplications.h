@@ -35,7 +35,17 @@ class HighsImplications {
   std::vector<Implics> implications;
   int64_t numImplications;
 
-  bool computeImplications(HighsInt col, bool val);
+ public:
+  // Outcome of fixing a binary column to one value and propagating
+  struct ProbeResult {
+    bool infeasible = false;
+    HighsInt numImplications = 0;
+    std::vector<HighsDomainChange> implics;
+  };
+
+ private:
+  bool computeImplications(HighsInt col, bool val,
+                           ProbeResult* probe = nullptr);
 
  public:
   struct VarBound {
@@ -131,7 +141,17 @@ class HighsImplications {
                                            const HighsSolution& lpSolution,
                                            double& bestLb) const;
 
-  bool runProbing(HighsInt col, HighsInt& numReductions);
+  // Fixes the binary column col to val in the given domain, propagates and
+  // records the implied bound changes before backtracking. Only reads the
+  // clique table and other shared data, so it can run concurrently on copies
+  // of the global domain.
+  void probeColumn(HighsDomain& domain, HighsInt col, bool val,
+                   ProbeResult& probe) const;
+
+  // Probes col on the global domain, or uses the results in probes[0] and
+  // probes[1] for fixing col to 0 and 1 if these are given
+  bool runProbing(HighsInt col, HighsInt& numReductions,
+                  ProbeResult* probes = nullptr);
 
   void rebuild(HighsInt ncols, const std::vector<HighsInt>& cIndex,
                const std::vector<HighsInt>& rIndex);
@@ -112,6 +112,11 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsMipSolver& mipsolver)
   lpsolver.setOptionValue(
       "dual_feasibility_tolerance",
       mipsolver.options_mip_->mip_feasibility_tolerance * 0.1);
+  // Cuts are added with their slacks basic, so the INVERT can be
+  // extended rather than formed again
+  lpsolver.setOptionValue(
+      "extend_invert_when_adding_rows",
+      mipsolver.options_mip_->extend_invert_when_adding_rows);
   status = Status::kNotSet;
   numlpiters = 0;
   avgSolveIters = 0;
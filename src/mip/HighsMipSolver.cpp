@@ -41,7 +41,9 @@ HighsMipSolver::HighsMipSolver(const HighsOptions& options, const HighsLp& lp,
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      work_limit(std::numeric_limits<int64_t>::max()),
+      interrupt_flag(nullptr) {
   if (solution.value_valid) {
     // MIP solver doesn't check row residuals, but they should be OK
     // so validate using assert
@@ -126,7 +128,13 @@ void HighsMipSolver::run() {
   mipdata_->runSetup();
 restart:
   if (modelstatus_ == HighsModelStatus::kNotset) {
+    // sub-MIP heuristics of the root node and the search run in the
+    // background when allowed. The ones of the root node are spawned when
+    // the tasks of the root node evaluation are finished
+    if (mipdata_->backgroundHeuristicsAllowed())
+      mipdata_->heuristics.startBackgroundSubMips();
     mipdata_->evaluateRootNode();
+    mipdata_->heuristics.spawnBackgroundSubMips();
     // age 5 times to remove stored but never violated cuts after root
     // separation
     mipdata_->cutpool.performAging();
@@ -162,6 +170,7 @@ restart:
   double upperLimLastCheck = mipdata_->upper_limit;
   double lowerBoundLastCheck = mipdata_->lower_bound;
   while (search.hasNode()) {
+    mipdata_->heuristics.collectBackgroundSubMips();
     mipdata_->conflictPool.performAging();
     // set iteration limit for each lp solve during the dive to 10 times the
     // average nodes
@@ -190,12 +199,14 @@ restart:
             mipdata_->heuristics.randomizedRounding(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
 
+          mipdata_->heuristics.collectBackgroundSubMips();
           if (mipdata_->incumbent.empty())
             mipdata_->heuristics.RENS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
           else
             mipdata_->heuristics.RINS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
+          mipdata_->heuristics.spawnBackgroundSubMips();
 
           mipdata_->heuristics.flushStatistics();
         }
@@ -246,6 +257,19 @@ restart:
     // the search datastructure should have no installed node now
     assert(!search.hasNode());
 
+    // solve the most promising open subtrees as sub-MIPs on concurrent
+    // workers
+    if (mipdata_->subtreeSubMipsAllowed()) {
+      mipdata_->subtreeSubMipRound();
+
+      if (mipdata_->checkLimits()) {
+        mipdata_->lower_bound = std::min(
+            mipdata_->upper_bound, mipdata_->nodequeue.getBestLowerBound());
+        mipdata_->printDisplayLine();
+        break;
+      }
+    }
+
     // propagate the global domain
     mipdata_->domain.propagate();
     mipdata_->pruned_treeweight += mipdata_->nodequeue.pruneInfeasibleNodes(
@@ -479,7 +503,47 @@ restart:
   cleanupSolve();
 }
 
+void HighsMipSolver::saveWarmStart(HighsMipWarmStart& warm_start) const {
+  warm_start.clear();
+  // without setup, e.g. if presolve solved the problem, there is no search
+  // data
+  if (!mipdata_ || !mipdata_->rowMatrixSet || numCol() == 0) return;
+
+  const presolve::HighsPostsolveStack& postSolveStack = mipdata_->postSolveStack;
+  warm_start.num_col = orig_model_->num_col_;
+  warm_start.num_row = orig_model_->num_row_;
+  warm_start.pscostinit = HighsPseudocostInitialization(
+      mipdata_->pseudocost, options_mip_->mip_pscost_minreliable,
+      postSolveStack);
+
+  // expand the root basis to the original space in the same way as for a
+  // restart
+  const HighsBasis& basis = mipdata_->firstrootbasis;
+  if (basis.valid) {
+    HighsBasis& root_basis = warm_start.root_basis;
+    root_basis.col_status.resize(postSolveStack.getOrigNumCol());
+    root_basis.row_status.resize(postSolveStack.getOrigNumRow(),
+                                 HighsBasisStatus::kBasic);
+    root_basis.valid = true;
+
+    for (HighsInt i = 0; i < numCol(); ++i)
+      root_basis.col_status[postSolveStack.getOrigColIndex(i)] =
+          basis.col_status[i];
+
+    HighsInt numRow =
+        std::min(HighsInt(basis.row_status.size()), this->numRow());
+    for (HighsInt i = 0; i < numRow; ++i)
+      root_basis.row_status[postSolveStack.getOrigRowIndex(i)] =
+          basis.row_status[i];
+  }
+
+  if (solution_objective_ != kHighsInf) warm_start.solution = solution_;
+  warm_start.valid = true;
+}
+
 void HighsMipSolver::cleanupSolve() {
+  // solutions of background sub-MIPs are added before the final status
+  mipdata_->heuristics.finishBackgroundSubMips();
   timer_.start(timer_.postsolve_clock);
   bool havesolution = solution_objective_ != kHighsInf;
   bool feasible;
@@ -605,6 +669,11 @@ void HighsMipSolver::cleanupSolve() {
                (long long unsigned)mipdata_->sb_lp_iterations,
                (long long unsigned)mipdata_->sepa_lp_iterations,
                (long long unsigned)mipdata_->heuristic_lp_iterations);
+  if (mipdata_->heuristics.getNumBackgroundSubMips() > 0)
+    highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                 "  Background MIPs   %llu\n",
+                 (long long unsigned)
+                     mipdata_->heuristics.getNumBackgroundSubMips());
 
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
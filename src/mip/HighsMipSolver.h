@@ -13,8 +13,11 @@
 #ifndef MIP_HIGHS_MIP_SOLVER_H_
 #define MIP_HIGHS_MIP_SOLVER_H_
 
+#include <atomic>
+
 #include "Highs.h"
 #include "lp_data/HighsOptions.h"
+#include "mip/HighsMipWarmStart.h"
 
 struct HighsMipSolverData;
 class HighsCutPool;
@@ -43,11 +46,20 @@ class HighsMipSolver {
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  // limit on the deterministic work units of the search, used for
+  // deterministic subtree sub-MIPs
+  int64_t work_limit;
+  // set by the parent search to stop a sub-MIP that runs in the background
+  const std::atomic<bool>* interrupt_flag;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
   void run();
 
+  // Stores the search data of the last run that remains useful when the
+  // model is solved again after changing bounds or costs
+  void saveWarmStart(HighsMipWarmStart& warm_start) const;
+
   HighsInt numCol() const { return model_->num_col_; }
 
   HighsInt numRow() const { return model_->num_row_; }
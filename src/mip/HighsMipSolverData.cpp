@@ -12,6 +12,8 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsMipSolverData.h"
 
+#include <atomic>
+#include <mutex>
 #include <random>
 
 #include "lp_data/HighsLpUtils.h"
@@ -80,6 +82,27 @@ bool HighsMipSolverData::trySolution(const std::vector<double>& solution,
   return addIncumbent(solution, double(obj), source);
 }
 
+void HighsMipSolverData::submitSolution(std::vector<double> solution,
+                                        char source) {
+  std::lock_guard<highs::parallel::mutex> lock(submittedSolutionsMutex);
+  submittedSolutions.emplace_back(std::move(solution), source);
+  haveSubmittedSolutions.store(true, std::memory_order_release);
+}
+
+void HighsMipSolverData::addSubmittedSolutions() {
+  if (!haveSubmittedSolutions.load(std::memory_order_acquire)) return;
+
+  std::vector<std::pair<std::vector<double>, char>> solutions;
+  {
+    std::lock_guard<highs::parallel::mutex> lock(submittedSolutionsMutex);
+    solutions.swap(submittedSolutions);
+    haveSubmittedSolutions.store(false, std::memory_order_relaxed);
+  }
+
+  for (const std::pair<std::vector<double>, char>& sol : solutions)
+    trySolution(sol.first, sol.second);
+}
+
 void HighsMipSolverData::startAnalyticCenterComputation(
     const highs::parallel::TaskGroup& taskGroup) {
   taskGroup.spawn([&]() {
@@ -213,6 +236,193 @@ void HighsMipSolverData::finishSymmetryDetection(
     globalOrbits = symmetries.computeStabilizerOrbits(domain);
 }
 
+int64_t HighsMipSolverData::workUnits() const {
+  // the work of propagating rows is counted in nonzeros, which are much
+  // cheaper than a simplex iteration
+  const int64_t kPropagationNnzPerWorkUnit = 64;
+  return total_lp_iterations + propagation_work / kPropagationNnzPerWorkUnit;
+}
+
+bool HighsMipSolverData::subtreeSubMipsAllowed() const {
+  return !mipsolver.submip && mipsolver.options_mip_->mip_subtree_submips &&
+         highs::parallel::num_threads() > 1 && nodequeue.numActiveNodes() > 1;
+}
+
+bool HighsMipSolverData::backgroundHeuristicsAllowed() const {
+  // background tasks finish at nondeterministic points of the search
+  return !mipsolver.submip &&
+         mipsolver.options_mip_->mip_background_heuristics &&
+         !mipsolver.options_mip_->mip_parallel_deterministic &&
+         highs::parallel::num_threads() > 1;
+}
+
+void HighsMipSolverData::solveSubtree(
+    const HighsNodeQueue::OpenNode& node, double cutoff,
+    const HighsPseudocostInitialization& pscostinit,
+    SubtreeSearchResult& result) {
+  // the subtree is the presolved model restricted to the global domain and
+  // the domain changes of the node
+  HighsLp subtree = *mipsolver.model_;
+  subtree.col_lower_ = domain.col_lower_;
+  subtree.col_upper_ = domain.col_upper_;
+  for (const HighsDomainChange& domchg : node.domchgstack) {
+    if (domchg.boundtype == HighsBoundType::kLower)
+      subtree.col_lower_[domchg.column] =
+          std::max(subtree.col_lower_[domchg.column], domchg.boundval);
+    else
+      subtree.col_upper_[domchg.column] =
+          std::min(subtree.col_upper_[domchg.column], domchg.boundval);
+
+    if (subtree.col_lower_[domchg.column] >
+        subtree.col_upper_[domchg.column] + feastol) {
+      // the node became infeasible due to global bound changes
+      result.solved = true;
+      result.lower_bound = kHighsInf;
+      return;
+    }
+  }
+
+  HighsOptions subtreeoptions = *mipsolver.options_mip_;
+  subtreeoptions.output_flag = false;
+  subtreeoptions.mip_max_nodes = HighsInt(std::min(
+      subtree_node_limit,
+      std::max(int64_t{0}, mipsolver.options_mip_->mip_max_nodes - num_nodes)));
+  subtreeoptions.mip_max_leaves = kHighsIInf;
+  subtreeoptions.mip_max_improving_sols = kHighsIInf;
+  subtreeoptions.mip_detect_symmetry = false;
+  subtreeoptions.time_limit -=
+      mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  // the objective bound of a MIP is given with respect to the objective
+  // including its offset
+  subtreeoptions.objective_bound = cutoff + subtree.offset_;
+
+  HighsSolution solution;
+  solution.value_valid = false;
+  solution.dual_valid = false;
+  HighsMipSolver subtreesolver(subtreeoptions, subtree, solution, true);
+  if (firstrootbasis.valid) subtreesolver.rootbasis = &firstrootbasis;
+  subtreesolver.pscostinit = &pscostinit;
+  subtreesolver.clqtableinit = &cliquetable;
+  subtreesolver.implicinit = &implications;
+  if (mipsolver.options_mip_->mip_parallel_deterministic)
+    subtreesolver.work_limit = subtree_work_limit;
+  subtreesolver.run();
+
+  result.num_nodes = std::max(int64_t{1}, subtreesolver.node_count_);
+  result.num_leaves = 1;
+  if (subtreesolver.mipdata_) {
+    result.num_leaves =
+        std::max(int64_t{1}, subtreesolver.mipdata_->num_leaves);
+    result.lp_iterations = subtreesolver.mipdata_->total_lp_iterations;
+  }
+
+  // a subtree that is infeasible with respect to the cutoff contains no
+  // improving solution and is therefore solved as well
+  result.solved =
+      subtreesolver.modelstatus_ == HighsModelStatus::kOptimal ||
+      subtreesolver.modelstatus_ == HighsModelStatus::kInfeasible;
+  result.lower_bound = subtreesolver.dual_bound_ - subtree.offset_;
+  if (subtreesolver.modelstatus_ != HighsModelStatus::kInfeasible)
+    result.solution = std::move(subtreesolver.solution_);
+}
+
+void HighsMipSolverData::subtreeSubMipRound() {
+  // This is not a parallel tree search: each subtree is solved by a sub-MIP
+  // that presolves and evaluates its own root node and shares no cuts or
+  // conflicts with the main search. A subtree that is not solved within the
+  // node limit loses its open nodes and is solved again in a later round
+  // with a doubled limit.
+  const HighsInt numWorkers = highs::parallel::num_threads();
+  // take more subtrees than workers so that workers which finish early can
+  // continue with the next subtree
+  const HighsInt numSubtrees = HighsInt(
+      std::min(int64_t{2} * numWorkers, nodequeue.numActiveNodes()));
+
+  std::vector<HighsNodeQueue::OpenNode> subtrees;
+  subtrees.reserve(numSubtrees);
+  for (HighsInt i = 0; i != numSubtrees; ++i)
+    subtrees.emplace_back(nodequeue.popBestBoundNode());
+
+  std::vector<SubtreeSearchResult> results(numSubtrees);
+  HighsPseudocostInitialization pscostinit(
+      pseudocost, mipsolver.options_mip_->mip_pscost_minreliable);
+
+  // In deterministic mode the start of each round is a barrier: all subtrees
+  // of the round see the incumbent from the barrier and stop after a fixed
+  // number of work units, so their results do not depend on how the subtrees
+  // are scheduled. Otherwise improving solutions are shared between the
+  // workers through the cutoff bound that is used for the subtrees that are
+  // started afterwards.
+  const bool deterministic = mipsolver.options_mip_->mip_parallel_deterministic;
+  if (deterministic && subtree_work_limit == 0)
+    subtree_work_limit = std::max(int64_t{1000}, 50 * firstrootlpiters);
+  highs::parallel::mutex cutoffMutex;
+  double cutoff = upper_limit;
+  std::atomic<HighsInt> nextSubtree{0};
+
+  highs::parallel::for_each(0, numWorkers, [&](HighsInt start, HighsInt end) {
+    for (HighsInt worker = start; worker != end; ++worker) {
+      while (true) {
+        HighsInt i = nextSubtree.fetch_add(1, std::memory_order_relaxed);
+        if (i >= numSubtrees) break;
+
+        double subtreeCutoff;
+        {
+          std::lock_guard<highs::parallel::mutex> lock(cutoffMutex);
+          subtreeCutoff = cutoff;
+        }
+
+        solveSubtree(subtrees[i], subtreeCutoff, pscostinit, results[i]);
+
+        if (!deterministic && !results[i].solution.empty()) {
+          double solobj = 0.0;
+          for (HighsInt j = 0; j != mipsolver.numCol(); ++j)
+            solobj += mipsolver.colCost(j) * results[i].solution[j];
+
+          double newCutoff = computeNewUpperLimit(solobj, 0.0, 0.0);
+          std::lock_guard<highs::parallel::mutex> lock(cutoffMutex);
+          cutoff = std::min(cutoff, newCutoff);
+        }
+      }
+    }
+  });
+
+  // merge the results in the order in which the subtrees were taken from the
+  // node queue
+  for (HighsInt i = 0; i != numSubtrees; ++i) {
+    num_nodes += results[i].num_nodes;
+    num_leaves += results[i].num_leaves;
+    total_lp_iterations += results[i].lp_iterations;
+    if (!results[i].solution.empty())
+      trySolution(results[i].solution, 'W');
+  }
+
+  // a new incumbent may have proven that no improving solution remains
+  if (domain.infeasible()) return;
+
+  bool limitReached = false;
+  for (HighsInt i = 0; i != numSubtrees; ++i) {
+    HighsNodeQueue::OpenNode& node = subtrees[i];
+    double nodeLb = std::max(node.lower_bound, results[i].lower_bound);
+    if (results[i].solved || nodeLb > upper_limit) {
+      pruned_treeweight += std::ldexp(1.0, 1 - node.depth);
+      continue;
+    }
+
+    // the subtree was not solved within the node limit, so the node is put
+    // back into the queue with the lower bound proven for its subtree
+    limitReached = true;
+    pruned_treeweight += nodequeue.emplaceNode(
+        std::move(node.domchgstack), std::move(node.branchings), nodeLb,
+        node.estimate, node.depth);
+  }
+
+  if (limitReached) {
+    subtree_node_limit *= 2;
+    subtree_work_limit *= 2;
+  }
+}
+
 double HighsMipSolverData::computeNewUpperLimit(double ub, double mip_abs_gap,
                                                 double mip_rel_gap) const {
   double new_upper_limit;
@@ -349,6 +559,10 @@ void HighsMipSolverData::init() {
       highs::parallel::num_threads() > 1
           ? mipsolver.options_mip_->mip_min_cliquetable_entries_for_parallelism
           : kHighsIInf);
+  cutpool.setMinCutsForParallelism(
+      highs::parallel::num_threads() > 1
+          ? mipsolver.options_mip_->mip_min_cutpool_rows_for_parallelism
+          : kHighsIInf);
   if (mipsolver.implicinit) implications.buildFrom(*mipsolver.implicinit);
   heuristic_effort = mipsolver.options_mip_->mip_heuristic_effort;
   detectSymmetries = mipsolver.options_mip_->mip_detect_symmetry;
@@ -376,6 +590,9 @@ void HighsMipSolverData::init() {
   sepa_lp_iterations_before_run = 0;
   sb_lp_iterations_before_run = 0;
   num_disp_lines = 0;
+  subtree_node_limit = 100;
+  subtree_work_limit = 0;
+  propagation_work = 0;
   numCliqueEntriesAfterPresolve = 0;
   numCliqueEntriesAfterFirstPresolve = 0;
   cliquesExtracted = false;
@@ -534,6 +751,8 @@ void HighsMipSolverData::runSetup() {
     maxAbsRowCoef[i] = maxabsval;
   }
 
+  setupLazyPropagation();
+
   // compute row activities and propagate all rows once
   objectiveFunction.setupCliquePartition(domain, cliquetable);
   domain.setupObjectivePropagation();
@@ -807,6 +1026,9 @@ double HighsMipSolverData::percentageInactiveIntegers() const {
 }
 
 void HighsMipSolverData::performRestart() {
+  // solutions of background sub-MIPs are in the space of the current model
+  heuristics.finishBackgroundSubMips();
+
   HighsBasis root_basis;
   HighsPseudocostInitialization pscostinit(
       pseudocost, mipsolver.options_mip_->mip_pscost_minreliable,
@@ -1616,6 +1838,24 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     return true;
   }
 
+  if (workUnits() >= mipsolver.work_limit) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "reached work limit\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kSolutionLimit;
+    }
+    return true;
+  }
+
+  if (mipsolver.interrupt_flag &&
+      mipsolver.interrupt_flag->load(std::memory_order_relaxed)) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo, "interrupted\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kSolutionLimit;
+    }
+    return true;
+  }
+
   if (mipsolver.timer_.read(mipsolver.timer_.solve_clock) >=
       options.time_limit) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
@@ -1638,6 +1878,60 @@ void HighsMipSolverData::checkObjIntegrality() {
   }
 }
 
+void HighsMipSolverData::setupLazyPropagation() {
+  const HighsLp& model = *mipsolver.model_;
+  lazyPropagationRowLength =
+      mipsolver.options_mip_->mip_lazy_propagation_row_length;
+  ARpropIndex_.clear();
+  ARpropValue_.clear();
+  ARpropRange_.clear();
+
+  bool haveLazyRows = false;
+  for (HighsInt i = 0; i != model.num_row_; ++i) {
+    if (lazyPropagationRow(i)) {
+      haveLazyRows = true;
+      break;
+    }
+  }
+  if (!haveLazyRows) {
+    lazyPropagationRowLength = kHighsIInf;
+    return;
+  }
+
+  // the local domains never exceed the model bounds, so the activity change
+  // of an entry over the model bounds limits the bound changes it can cause
+  ARpropIndex_.resize(ARindex_.size());
+  ARpropValue_.resize(ARvalue_.size());
+  ARpropRange_.resize(ARvalue_.size());
+  std::vector<std::pair<double, HighsInt>> entries;
+  for (HighsInt i = 0; i != model.num_row_; ++i) {
+    if (!lazyPropagationRow(i)) continue;
+
+    HighsInt start = ARstart_[i];
+    HighsInt end = ARstart_[i + 1];
+    entries.clear();
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = ARindex_[j];
+      double range = model.col_upper_[col] - model.col_lower_[col];
+      entries.emplace_back(std::abs(ARvalue_[j]) * range, j);
+    }
+
+    pdqsort(entries.begin(), entries.end(),
+            [](const std::pair<double, HighsInt>& a,
+               const std::pair<double, HighsInt>& b) {
+              return a.first > b.first ||
+                     (a.first == b.first && a.second < b.second);
+            });
+
+    for (HighsInt j = start; j != end; ++j) {
+      const std::pair<double, HighsInt>& entry = entries[j - start];
+      ARpropIndex_[j] = ARindex_[entry.second];
+      ARpropValue_[j] = ARvalue_[entry.second];
+      ARpropRange_[j] = entry.first;
+    }
+  }
+}
+
 void HighsMipSolverData::setupDomainPropagation() {
   const HighsLp& model = *mipsolver.model_;
   highsSparseTranspose(model.num_row_, model.num_col_, model.a_matrix_.start_,
@@ -1659,6 +1953,8 @@ void HighsMipSolverData::setupDomainPropagation() {
     maxAbsRowCoef[i] = maxabsval;
   }
 
+  setupLazyPropagation();
+
   domain = HighsDomain(mipsolver);
   domain.computeRowActivities();
 }
@@ -14,6 +14,8 @@
 #ifndef HIGHS_MIP_SOLVER_DATA_H_
 #define HIGHS_MIP_SOLVER_DATA_H_
 
+#include <atomic>
+#include <utility>
 #include <vector>
 
 #include "mip/HighsCliqueTable.h"
@@ -62,6 +64,13 @@ struct HighsMipSolverData {
   std::vector<HighsInt> ARstart_;
   std::vector<HighsInt> ARindex_;
   std::vector<double> ARvalue_;
+  // entries of the rows that are propagated lazily, sorted by their maximal
+  // activity change over the model bounds and stored at the same positions as
+  // in the row-wise matrix
+  std::vector<HighsInt> ARpropIndex_;
+  std::vector<double> ARpropValue_;
+  std::vector<double> ARpropRange_;
+  HighsInt lazyPropagationRowLength = kHighsIInf;
   std::vector<double> maxAbsRowCoef;
   std::vector<uint8_t> rowintegral;
   std::vector<HighsInt> uplocks;
@@ -104,6 +113,10 @@ struct HighsMipSolverData {
   int64_t sepa_lp_iterations_before_run;
   int64_t sb_lp_iterations_before_run;
   int64_t num_disp_lines;
+  int64_t subtree_node_limit;
+  int64_t subtree_work_limit;
+  // atomic since presolve probes on copies of the global domain concurrently
+  std::atomic<int64_t> propagation_work;
 
   HighsInt numImprovingSols;
   double lower_bound;
@@ -116,6 +129,12 @@ struct HighsMipSolverData {
 
   HighsDebugSol debugSolution;
 
+  // solutions found by background tasks, which are added as incumbents by
+  // the main search at its next polling point
+  highs::parallel::mutex submittedSolutionsMutex;
+  std::vector<std::pair<std::vector<double>, char>> submittedSolutions;
+  std::atomic<bool> haveSubmittedSolutions;
+
   HighsMipSolverData(HighsMipSolver& mipsolver)
       : mipsolver(mipsolver),
         cutpool(mipsolver.numCol(), mipsolver.options_mip_->mip_pool_age_limit,
@@ -129,7 +148,8 @@ struct HighsMipSolverData {
         implications(mipsolver),
         heuristics(mipsolver),
         objectiveFunction(mipsolver),
-        debugSolution(mipsolver) {
+        debugSolution(mipsolver),
+        haveSubmittedSolutions(false) {
     domain.addCutpool(cutpool);
     domain.addConflictPool(conflictPool);
   }
@@ -150,6 +170,23 @@ struct HighsMipSolverData {
   void finishSymmetryDetection(const highs::parallel::TaskGroup& taskGroup,
                                std::unique_ptr<SymmetryDetectionData>& symData);
 
+  struct SubtreeSearchResult {
+    std::vector<double> solution;
+    double lower_bound = -kHighsInf;
+    int64_t num_nodes = 0;
+    int64_t num_leaves = 0;
+    int64_t lp_iterations = 0;
+    bool solved = false;
+  };
+
+  int64_t workUnits() const;
+  bool subtreeSubMipsAllowed() const;
+  void solveSubtree(const HighsNodeQueue::OpenNode& node, double cutoff,
+                    const HighsPseudocostInitialization& pscostinit,
+                    SubtreeSearchResult& result);
+  void subtreeSubMipRound();
+  bool backgroundHeuristicsAllowed() const;
+
   double computeNewUpperLimit(double upper_bound, double mip_abs_gap,
                               double mip_rel_gap) const;
   bool moreHeuristicsAllowed() const;
@@ -159,12 +196,15 @@ struct HighsMipSolverData {
   void checkObjIntegrality();
   void runPresolve();
   void setupDomainPropagation();
+  void setupLazyPropagation();
   void runSetup();
   double transformNewIncumbent(const std::vector<double>& sol);
   double percentageInactiveIntegers() const;
   void performRestart();
   bool checkSolution(const std::vector<double>& solution) const;
   bool trySolution(const std::vector<double>& solution, char source = ' ');
+  void submitSolution(std::vector<double> solution, char source);
+  void addSubmittedSolutions();
   bool rootSeparationRound(HighsSeparation& sepa, HighsInt& ncuts,
                            HighsLpRelaxation::Status& status);
   HighsLpRelaxation::Status evaluateRootLp();
@@ -183,6 +223,10 @@ struct HighsMipSolverData {
     rowvals = ARvalue_.data() + start;
   }
 
+  bool lazyPropagationRow(HighsInt row) const {
+    return ARstart_[row + 1] - ARstart_[row] >= lazyPropagationRowLength;
+  }
+
   bool checkLimits(int64_t nodeOffset = 0) const;
 };
 
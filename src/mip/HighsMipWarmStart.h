@@ -0,0 +1,85 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef HIGHS_MIP_WARM_START_H_
+#define HIGHS_MIP_WARM_START_H_
+
+#include <cmath>
+#include <vector>
+
+#include "lp_data/HStruct.h"
+#include "lp_data/HighsLp.h"
+#include "mip/HighsPseudocost.h"
+
+// Data from a MIP solve that stays meaningful when bounds or costs of the
+// model are changed before the next solve. Everything refers to the columns
+// and rows of the original model, so it can be mapped into the space of a
+// new presolve. Pseudocosts and the root basis only guide the search and are
+// always safe to reuse. The incumbent is only used as MIP start if it is
+// still feasible for the modified model.
+//
+// The clique table is not kept. Some of its cliques only hold for the
+// optimal solutions of the previous model. Cliques extracted from the
+// objective cutoff are invalid after any change to the costs, and after
+// a bound change that makes the previous incumbent infeasible. Dual
+// fixing and dominated column reductions of presolve fix columns because
+// of the costs and the bounds of other columns. Cliques extracted from
+// rows in which such a column was fixed need not hold once those costs or
+// bounds change, nor those found by probing on the reduced model. The
+// table does not record where a clique came from, so the valid cliques
+// cannot be separated from the others.
+struct HighsMipWarmStart {
+  bool valid = false;
+  HighsInt num_col = 0;
+  HighsInt num_row = 0;
+  HighsPseudocostInitialization pscostinit;
+  HighsBasis root_basis;
+  std::vector<double> solution;
+
+  bool matches(HighsInt model_num_col, HighsInt model_num_row) const {
+    return valid && num_col == model_num_col && num_row == model_num_row;
+  }
+
+  // Checks whether the stored incumbent is feasible for @lp and computes its
+  // row activities
+  bool feasibleSolution(const HighsLp& lp, double feastol,
+                        std::vector<double>& row_value) const {
+    if ((HighsInt)solution.size() != lp.num_col_) return false;
+    for (HighsInt i = 0; i != lp.num_col_; ++i) {
+      const double value = solution[i];
+      if (value < lp.col_lower_[i] - feastol ||
+          value > lp.col_upper_[i] + feastol)
+        return false;
+      if (lp.integrality_[i] == HighsVarType::kInteger &&
+          std::fabs(value - std::floor(value + 0.5)) > feastol)
+        return false;
+    }
+    lp.a_matrix_.productQuad(row_value, solution);
+    for (HighsInt i = 0; i != lp.num_row_; ++i) {
+      if (row_value[i] < lp.row_lower_[i] - feastol ||
+          row_value[i] > lp.row_upper_[i] + feastol)
+        return false;
+    }
+    return true;
+  }
+
+  void clear() {
+    valid = false;
+    num_col = 0;
+    num_row = 0;
+    pscostinit = HighsPseudocostInitialization();
+    root_basis.clear();
+    solution.clear();
+  }
+};
+
+#endif
@@ -29,7 +29,9 @@
 HighsPrimalHeuristics::HighsPrimalHeuristics(HighsMipSolver& mipsolver)
     : mipsolver(mipsolver),
       lp_iterations(0),
-      randgen(mipsolver.options_mip_->random_seed) {
+      randgen(mipsolver.options_mip_->random_seed),
+      background(false),
+      numBackgroundSubMips(0) {
   successObservations = 0;
   numSuccessObservations = 0;
   infeasObservations = 0;
@@ -70,18 +72,85 @@ void HighsPrimalHeuristics::setupIntCols() {
   });
 }
 
-bool HighsPrimalHeuristics::solveSubMip(
-    const HighsLp& lp, const HighsBasis& basis, double fixingRate,
+struct HighsPrimalHeuristics::SubMip {
+  HighsOptions options;
+  HighsLp lp;
+  HighsPseudocostInitialization pscostinit;
+  double fixingRate;
+
+  HighsModelStatus modelstatus = HighsModelStatus::kNotset;
+  bool setupDone = false;
+  HighsInt numCol = 0;
+  int64_t lp_iterations = 0;
+  int64_t node_count = 0;
+  std::vector<double> solution;
+
+  void run(const HighsBasis& basis, const HighsCliqueTable* clqtableinit,
+           const HighsImplications* implicinit,
+           const std::atomic<bool>* interrupt_flag = nullptr) {
+    HighsSolution initsol;
+    initsol.value_valid = false;
+    initsol.dual_valid = false;
+    HighsMipSolver submipsolver(options, lp, initsol, true);
+    submipsolver.rootbasis = &basis;
+    submipsolver.pscostinit = &pscostinit;
+    submipsolver.clqtableinit = clqtableinit;
+    submipsolver.implicinit = implicinit;
+    submipsolver.interrupt_flag = interrupt_flag;
+    submipsolver.run();
+
+    modelstatus = submipsolver.modelstatus_;
+    node_count = submipsolver.node_count_;
+    if (submipsolver.mipdata_) {
+      setupDone = true;
+      numCol = submipsolver.numCol();
+      lp_iterations = submipsolver.mipdata_->total_lp_iterations;
+    }
+    if (modelstatus != HighsModelStatus::kInfeasible)
+      solution = std::move(submipsolver.solution_);
+  }
+};
+
+// A sub-MIP that runs as a task while the main search continues. It owns
+// copies of all data that the main search may modify in the meantime and the
+// task group is declared last so that it waits for the task before the data
+// is destroyed. The task group is only created when the task is spawned.
+struct HighsPrimalHeuristics::BackgroundSubMip {
+  SubMip submip;
+  HighsBasis basis;
+  HighsCliqueTable cliquetable;
+  std::atomic<bool> finished;
+  std::atomic<bool> interrupted;
+  std::unique_ptr<highs::parallel::TaskGroup> taskGroup;
+
+  BackgroundSubMip(const HighsBasis& basis, HighsInt numCol)
+      : basis(basis),
+        cliquetable(numCol),
+        finished(false),
+        interrupted(false) {}
+};
+
+HighsPrimalHeuristics::~HighsPrimalHeuristics() {
+  // the task groups wait for their sub-MIP in reverse order of creation
+  while (!backgroundSubMips.empty()) backgroundSubMips.pop_back();
+}
+
+void HighsPrimalHeuristics::setupSubMip(
+    SubMip& submip, const HighsLp& lp, double fixingRate,
     std::vector<double> colLower, std::vector<double> colUpper,
     HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
-  HighsOptions submipoptions = *mipsolver.options_mip_;
-  HighsLp submip = lp;
+  HighsOptions& submipoptions = submip.options;
+  submipoptions = *mipsolver.options_mip_;
+  submip.lp = lp;
+  submip.pscostinit =
+      HighsPseudocostInitialization(mipsolver.mipdata_->pseudocost, 1);
+  submip.fixingRate = fixingRate;
 
   // set bounds and restore integrality of the lp relaxation copy
-  submip.col_lower_ = std::move(colLower);
-  submip.col_upper_ = std::move(colUpper);
-  submip.integrality_ = mipsolver.model_->integrality_;
-  submip.offset_ = 0;
+  submip.lp.col_lower_ = std::move(colLower);
+  submip.lp.col_upper_ = std::move(colUpper);
+  submip.lp.integrality_ = mipsolver.model_->integrality_;
+  submip.lp.offset_ = 0;
 
   // set limits
   submipoptions.mip_max_leaves = maxleaves;
@@ -110,54 +179,134 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.presolve = "on";
   submipoptions.mip_detect_symmetry = false;
   submipoptions.mip_heuristic_effort = 0.8;
-  // setup solver and run it
-
-  HighsSolution solution;
-  solution.value_valid = false;
-  solution.dual_valid = false;
-  HighsMipSolver submipsolver(submipoptions, submip, solution, true);
-  submipsolver.rootbasis = &basis;
-  HighsPseudocostInitialization pscostinit(mipsolver.mipdata_->pseudocost, 1);
-  submipsolver.pscostinit = &pscostinit;
-  submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
-  submipsolver.implicinit = &mipsolver.mipdata_->implications;
-  submipsolver.run();
-  if (submipsolver.mipdata_) {
+}
+
+bool HighsPrimalHeuristics::finishSubMip(SubMip& submip) {
+  if (submip.setupDone) {
     double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
                         mipsolver.mipdata_->continuous_cols.size();
-    double adjustmentfactor = submipsolver.numCol() / std::max(1.0, numUnfixed);
+    double adjustmentfactor = submip.numCol / std::max(1.0, numUnfixed);
     // (double)mipsolver.orig_model_->a_matrix_.value_.size();
     int64_t adjusted_lp_iterations =
-        (size_t)(adjustmentfactor * submipsolver.mipdata_->total_lp_iterations);
+        (size_t)(adjustmentfactor * submip.lp_iterations);
     lp_iterations += adjusted_lp_iterations;
 
     if (mipsolver.submip)
       mipsolver.mipdata_->num_nodes += std::max(
-          int64_t{1}, int64_t(adjustmentfactor * submipsolver.node_count_));
+          int64_t{1}, int64_t(adjustmentfactor * submip.node_count));
   }
 
-  if (submipsolver.modelstatus_ == HighsModelStatus::kInfeasible) {
-    infeasObservations += fixingRate;
+  if (submip.modelstatus == HighsModelStatus::kInfeasible) {
+    infeasObservations += submip.fixingRate;
     ++numInfeasObservations;
   }
-  if (submipsolver.node_count_ <= 1 &&
-      submipsolver.modelstatus_ == HighsModelStatus::kInfeasible)
+  if (submip.node_count <= 1 &&
+      submip.modelstatus == HighsModelStatus::kInfeasible)
     return false;
   HighsInt oldNumImprovingSols = mipsolver.mipdata_->numImprovingSols;
-  if (submipsolver.modelstatus_ != HighsModelStatus::kInfeasible &&
-      !submipsolver.solution_.empty()) {
-    mipsolver.mipdata_->trySolution(submipsolver.solution_, 'L');
-  }
+  if (!submip.solution.empty())
+    mipsolver.mipdata_->trySolution(submip.solution, 'L');
+  // solutions submitted by a background sub-MIP
+  mipsolver.mipdata_->addSubmittedSolutions();
 
   if (mipsolver.mipdata_->numImprovingSols != oldNumImprovingSols) {
     // remember fixing rate as good
-    successObservations += fixingRate;
+    successObservations += submip.fixingRate;
     ++numSuccessObservations;
   }
 
   return true;
 }
 
+bool HighsPrimalHeuristics::solveSubMip(
+    const HighsLp& lp, const HighsBasis& basis, double fixingRate,
+    std::vector<double> colLower, std::vector<double> colUpper,
+    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
+  if (background) {
+    // queue the sub-MIP to be solved as a task and continue with the
+    // search. The task copies the clique table and starts without
+    // implications, since both are modified by the main search while the
+    // task runs.
+    assert(canStartSubMip());
+    backgroundSubMips.emplace_back(
+        new BackgroundSubMip(basis, mipsolver.numCol()));
+    BackgroundSubMip& task = *backgroundSubMips.back();
+    task.cliquetable.buildFrom(mipsolver.model_,
+                               mipsolver.mipdata_->cliquetable);
+    setupSubMip(task.submip, lp, fixingRate, std::move(colLower),
+                std::move(colUpper), maxleaves, maxnodes, stallnodes);
+    return true;
+  }
+
+  SubMip submip;
+  setupSubMip(submip, lp, fixingRate, std::move(colLower), std::move(colUpper),
+              maxleaves, maxnodes, stallnodes);
+  submip.run(basis, &mipsolver.mipdata_->cliquetable,
+             &mipsolver.mipdata_->implications);
+  return finishSubMip(submip);
+}
+
+void HighsPrimalHeuristics::startBackgroundSubMips() { background = true; }
+
+bool HighsPrimalHeuristics::canStartSubMip() const {
+  // one sub-MIP per thread may be queued or running in the background, so
+  // that the search never waits for a slot
+  return !background ||
+         HighsInt(backgroundSubMips.size()) < highs::parallel::num_threads();
+}
+
+void HighsPrimalHeuristics::spawnBackgroundSubMips() {
+  HighsMipSolverData* mipdata = mipsolver.mipdata_.get();
+  for (std::unique_ptr<BackgroundSubMip>& queued : backgroundSubMips) {
+    if (queued->taskGroup) continue;
+
+    BackgroundSubMip* task = queued.get();
+    task->taskGroup.reset(new highs::parallel::TaskGroup());
+    task->taskGroup->spawn([task, mipdata]() {
+      task->submip.run(task->basis, &task->cliquetable, nullptr,
+                       &task->interrupted);
+      if (!task->submip.solution.empty())
+        mipdata->submitSolution(std::move(task->submip.solution), 'L');
+      task->finished.store(true, std::memory_order_release);
+    });
+  }
+}
+
+void HighsPrimalHeuristics::collectBackgroundSubMips() {
+  // solutions are submitted as soon as a sub-MIP finds them. The sub-MIPs
+  // themselves are collected from the last one spawned, since their task
+  // groups share the deque of this worker
+  while (!backgroundSubMips.empty() &&
+         backgroundSubMips.back()->finished.load(std::memory_order_acquire)) {
+    backgroundSubMips.back()->taskGroup->taskWait();
+    finishSubMip(backgroundSubMips.back()->submip);
+    backgroundSubMips.pop_back();
+    ++numBackgroundSubMips;
+  }
+  mipsolver.mipdata_->addSubmittedSolutions();
+  flushStatistics();
+}
+
+void HighsPrimalHeuristics::finishBackgroundSubMips() {
+  // sub-MIPs that were not yet picked up by a worker are dropped, and the
+  // running ones are interrupted and return their best solution
+  for (std::unique_ptr<BackgroundSubMip>& task : backgroundSubMips) {
+    task->interrupted.store(true, std::memory_order_relaxed);
+    if (task->taskGroup) task->taskGroup->cancel();
+  }
+  while (!backgroundSubMips.empty()) {
+    BackgroundSubMip& task = *backgroundSubMips.back();
+    if (task.taskGroup) task.taskGroup->taskWait();
+    if (task.finished.load(std::memory_order_acquire)) {
+      finishSubMip(task.submip);
+      ++numBackgroundSubMips;
+    }
+    backgroundSubMips.pop_back();
+  }
+  mipsolver.mipdata_->addSubmittedSolutions();
+  flushStatistics();
+}
+
 double HighsPrimalHeuristics::determineTargetFixingRate() {
   double lowFixingRate = 0.6;
   double highFixingRate = 0.6;
@@ -216,6 +365,7 @@ class HeuristicNeighborhood {
 };
 
 void HighsPrimalHeuristics::rootReducedCost() {
+  if (!canStartSubMip()) return;
   std::vector<std::pair<double, HighsDomainChange>> lurkingBounds =
       mipsolver.mipdata_->redcostfixing.getLurkingBounds(mipsolver);
   if (lurkingBounds.size() < 0.1 * mipsolver.mipdata_->integral_cols.size())
@@ -274,6 +424,7 @@ void HighsPrimalHeuristics::rootReducedCost() {
 }
 
 void HighsPrimalHeuristics::RENS(const std::vector<double>& tmp) {
+  if (!canStartSubMip()) return;
   HighsPseudocost pscost(mipsolver.mipdata_->pseudocost);
   HighsSearch heur(mipsolver, pscost);
   HighsDomain& localdom = heur.getLocalDomain();
@@ -518,6 +669,7 @@ retry:
 }
 
 void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol) {
+  if (!canStartSubMip()) return;
   if (int(relaxationsol.size()) != mipsolver.numCol()) return;
 
   intcols.erase(std::remove_if(intcols.begin(), intcols.end(),
@@ -13,6 +13,7 @@
 #ifndef HIGHS_PRIMAL_HEURISTICS_H_
 #define HIGHS_PRIMAL_HEURISTICS_H_
 
+#include <memory>
 #include <vector>
 
 #include "lp_data/HStruct.h"
@@ -35,9 +36,37 @@ class HighsPrimalHeuristics {
 
   std::vector<HighsInt> intcols;
 
+  struct SubMip;
+  struct BackgroundSubMip;
+  // sub-MIPs solved in the background, in the order in which they were
+  // queued. Their task groups have to be waited for in reverse order
+  std::vector<std::unique_ptr<BackgroundSubMip>> backgroundSubMips;
+  bool background;
+  int64_t numBackgroundSubMips;
+
+  void setupSubMip(SubMip& submip, const HighsLp& lp, double fixingRate,
+                   std::vector<double> colLower, std::vector<double> colUpper,
+                   HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes);
+
+  bool finishSubMip(SubMip& submip);
+
  public:
   HighsPrimalHeuristics(HighsMipSolver& mipsolver);
 
+  ~HighsPrimalHeuristics();
+
+  void startBackgroundSubMips();
+
+  bool canStartSubMip() const;
+
+  void spawnBackgroundSubMips();
+
+  void collectBackgroundSubMips();
+
+  void finishBackgroundSubMips();
+
+  int64_t getNumBackgroundSubMips() const { return numBackgroundSubMips; }
+
   void setupIntCols();
 
   bool solveSubMip(const HighsLp& lp, const HighsBasis& basis,
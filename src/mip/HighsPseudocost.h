@@ -40,12 +40,13 @@ struct HighsPseudocostInitialization {
   std::vector<HighsInt> ninferencesdown;
   std::vector<double> conflictscoreup;
   std::vector<double> conflictscoredown;
-  double cost_total;
-  double inferences_total;
-  double conflict_avg_score;
-  int64_t nsamplestotal;
-  int64_t ninferencestotal;
+  double cost_total = 0;
+  double inferences_total = 0;
+  double conflict_avg_score = 0;
+  int64_t nsamplestotal = 0;
+  int64_t ninferencestotal = 0;
 
+  HighsPseudocostInitialization() = default;
   HighsPseudocostInitialization(const HighsPseudocost& pscost,
                                 HighsInt maxCount);
   HighsPseudocostInitialization(
@@ -27,6 +27,7 @@
 #include "mip/HighsImplications.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsObjectiveFunction.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "test/DevKkt.h"
@@ -1340,9 +1341,75 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
         std::max(mipsolver->submip ? HighsInt{0} : HighsInt{100000},
                  10 * numNonzeros());
     HighsInt numFail = 0;
-    for (const std::tuple<int64_t, HighsInt, HighsInt, HighsInt>& binvar :
-         binaries) {
-      HighsInt i = std::get<3>(binvar);
+
+    // With several threads the upcoming candidates are probed ahead in
+    // batches on copies of the global domain, one copy per thread. Each copy
+    // probes a fixed share of the batch and the results are applied in the
+    // order of the candidates below, so that the outcome only depends on the
+    // number of threads.
+    const HighsInt numThreads = highs::parallel::num_threads();
+    std::vector<HighsDomain> probingDomains;
+    size_t probingDomainsStackSize = 0;
+    std::vector<size_t> batchPos;
+    std::vector<HighsImplications::ProbeResult> batchProbes;
+    size_t nextBatchPos = 0;
+    size_t batchEnd = 0;
+
+    auto probeBatch = [&](size_t start) {
+      const size_t batchSize = 8 * numThreads;
+      batchPos.clear();
+      size_t k = start;
+      for (; k != binaries.size() && batchPos.size() != batchSize; ++k) {
+        HighsInt col = std::get<3>(binaries[k]);
+        if (domain.isBinary(col) &&
+            cliquetable.getSubstitution(col) == nullptr &&
+            !implications.implicationsCached(col, 0) &&
+            !implications.implicationsCached(col, 1))
+          batchPos.push_back(k);
+      }
+      batchEnd = k;
+      nextBatchPos = 0;
+
+      // bring the copies up to date with the bound changes that were found
+      // on the global domain since the last batch
+      const std::vector<HighsDomainChange>& domchgstack =
+          domain.getDomainChangeStack();
+      if (probingDomains.empty() ||
+          domchgstack.size() < probingDomainsStackSize) {
+        probingDomains.assign(numThreads, domain);
+      } else {
+        for (HighsDomain& probingDomain : probingDomains) {
+          for (size_t j = probingDomainsStackSize; j < domchgstack.size(); ++j)
+            probingDomain.changeBound(domchgstack[j],
+                                      HighsDomain::Reason::unspecified());
+          probingDomain.propagate();
+          if (probingDomain.infeasible())
+            probingDomain = domain;
+          else
+            probingDomain.clearChangedCols();
+        }
+      }
+      probingDomainsStackSize = domchgstack.size();
+
+      batchProbes.resize(2 * batchPos.size());
+      highs::parallel::for_each(
+          0, numThreads,
+          [&](HighsInt start, HighsInt end) {
+            for (HighsInt t = start; t != end; ++t) {
+              for (size_t j = t; j < batchPos.size(); j += numThreads) {
+                HighsInt col = std::get<3>(binaries[batchPos[j]]);
+                implications.probeColumn(probingDomains[t], col, 1,
+                                         batchProbes[2 * j + 1]);
+                implications.probeColumn(probingDomains[t], col, 0,
+                                         batchProbes[2 * j]);
+              }
+            }
+          },
+          1);
+    };
+
+    for (size_t k = 0; k != binaries.size(); ++k) {
+      HighsInt i = std::get<3>(binaries[k]);
 
       if (cliquetable.getSubstitution(i) != nullptr) continue;
 
@@ -1376,9 +1443,22 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
 
         if (probingContingent - numProbed < 0) break;
 
+        HighsImplications::ProbeResult* probes = nullptr;
+        if (numThreads > 1) {
+          if (k >= batchEnd) {
+            domain.propagate();
+            if (domain.infeasible()) return Result::kPrimalInfeasible;
+            probeBatch(k);
+          }
+          while (nextBatchPos < batchPos.size() && batchPos[nextBatchPos] < k)
+            ++nextBatchPos;
+          if (nextBatchPos < batchPos.size() && batchPos[nextBatchPos] == k)
+            probes = &batchProbes[2 * nextBatchPos];
+        }
+
         HighsInt numBoundChgs = 0;
         HighsInt numNewCliques = -cliquetable.numCliques();
-        if (!implications.runProbing(i, numBoundChgs)) continue;
+        if (!implications.runProbing(i, numBoundChgs, probes)) continue;
         probingContingent += numBoundChgs;
         numNewCliques += cliquetable.numCliques();
         numNewCliques = std::max(numNewCliques, HighsInt{0});
@@ -4947,229 +5027,282 @@ HPresolve::Result HPresolve::removeDoubletonEquations(
   return Result::kOk;
 }
 
-HighsInt HPresolve::strengthenInequalities() {
-  std::vector<int8_t> complementation;
-  std::vector<double> reducedcost;
-  std::vector<double> upper;
-  std::vector<HighsInt> indices;
-  std::vector<HighsInt> positions;
-  std::vector<HighsInt> stack;
-  std::vector<double> coefs;
-  std::vector<HighsInt> cover;
-
-  HighsInt numstrenghtened = 0;
-
-  for (HighsInt row = 0; row != model->num_row_; ++row) {
-    if (rowsize[row] <= 1) continue;
-    if (model->row_lower_[row] != -kHighsInf &&
-        model->row_upper_[row] != kHighsInf)
-      continue;
+bool HPresolve::strengthenInequality(
+    HighsInt row, StrengthenInequalityWorkspace& workspace,
+    std::vector<std::pair<HighsInt, double>>& coefdelta, double& side) const {
+  if (rowsize[row] <= 1) return false;
+  if (model->row_lower_[row] != -kHighsInf &&
+      model->row_upper_[row] != kHighsInf)
+    return false;
 
-    // do not run on very dense rows as this could get expensive
-    if (rowsize[row] >
-        std::max(HighsInt{1000},
-                 HighsInt(0.05 * (model->num_col_ - numDeletedCols))))
-      continue;
+  // do not run on very dense rows as this could get expensive
+  if (rowsize[row] >
+      std::max(HighsInt{1000},
+               HighsInt(0.05 * (model->num_col_ - numDeletedCols))))
+    return false;
 
-    // printf("strengthening knapsack of %" HIGHSINT_FORMAT " vars\n",
-    // rowsize[row]);
+  // printf("strengthening knapsack of %" HIGHSINT_FORMAT " vars\n",
+  // rowsize[row]);
 
-    HighsCDouble maxviolation;
-    HighsCDouble continuouscontribution = 0.0;
-    double scale;
+  HighsCDouble maxviolation;
+  HighsCDouble continuouscontribution = 0.0;
+  double scale;
 
-    if (model->row_lower_[row] != -kHighsInf) {
-      maxviolation = model->row_lower_[row];
-      scale = -1.0;
-    } else {
-      maxviolation = -model->row_upper_[row];
-      scale = 1.0;
+  if (model->row_lower_[row] != -kHighsInf) {
+    maxviolation = model->row_lower_[row];
+    scale = -1.0;
+  } else {
+    maxviolation = -model->row_upper_[row];
+    scale = 1.0;
+  }
+
+  std::vector<int8_t>& complementation = workspace.complementation;
+  std::vector<double>& reducedcost = workspace.reducedcost;
+  std::vector<double>& upper = workspace.upper;
+  std::vector<HighsInt>& indices = workspace.indices;
+  std::vector<HighsInt>& positions = workspace.positions;
+  std::vector<HighsInt>& stack = workspace.stack;
+  std::vector<double>& coefs = workspace.coefs;
+  std::vector<HighsInt>& cover = workspace.cover;
+
+  complementation.clear();
+  reducedcost.clear();
+  upper.clear();
+  indices.clear();
+  positions.clear();
+  complementation.reserve(rowsize[row]);
+  reducedcost.reserve(rowsize[row]);
+  upper.reserve(rowsize[row]);
+  indices.reserve(rowsize[row]);
+  stack.reserve(rowsize[row]);
+  stack.push_back(rowroot[row]);
+
+  bool skiprow = false;
+
+  while (!stack.empty()) {
+    HighsInt pos = stack.back();
+    stack.pop_back();
+
+    if (ARright[pos] != -1) stack.push_back(ARright[pos]);
+    if (ARleft[pos] != -1) stack.push_back(ARleft[pos]);
+
+    int8_t comp;
+    double weight;
+    double ub;
+    weight = Avalue[pos] * scale;
+    HighsInt col = Acol[pos];
+    ub = model->col_upper_[col] - model->col_lower_[col];
+
+    if (ub == kHighsInf) {
+      skiprow = true;
+      break;
     }
 
-    complementation.clear();
-    reducedcost.clear();
-    upper.clear();
-    indices.clear();
-    positions.clear();
-    complementation.reserve(rowsize[row]);
-    reducedcost.reserve(rowsize[row]);
-    upper.reserve(rowsize[row]);
-    indices.reserve(rowsize[row]);
-    stack.reserve(rowsize[row]);
-    stack.push_back(rowroot[row]);
-
-    bool skiprow = false;
-
-    while (!stack.empty()) {
-      HighsInt pos = stack.back();
-      stack.pop_back();
-
-      if (ARright[pos] != -1) stack.push_back(ARright[pos]);
-      if (ARleft[pos] != -1) stack.push_back(ARleft[pos]);
-
-      int8_t comp;
-      double weight;
-      double ub;
-      weight = Avalue[pos] * scale;
-      HighsInt col = Acol[pos];
-      ub = model->col_upper_[col] - model->col_lower_[col];
-
-      if (ub == kHighsInf) {
+    if (weight > 0) {
+      if (model->col_upper_[col] == kHighsInf) {
         skiprow = true;
         break;
       }
 
-      if (weight > 0) {
-        if (model->col_upper_[col] == kHighsInf) {
-          skiprow = true;
-          break;
-        }
-
-        comp = 1;
-        maxviolation += model->col_upper_[col] * weight;
-      } else {
-        if (model->col_lower_[col] == -kHighsInf) {
-          skiprow = true;
-          break;
-        }
-        comp = -1;
-        maxviolation += model->col_lower_[col] * weight;
-        weight = -weight;
-      }
-
-      if (ub <= primal_feastol || weight <= primal_feastol) continue;
-
-      if (model->integrality_[col] == HighsVarType::kContinuous) {
-        continuouscontribution += weight * ub;
-        continue;
+      comp = 1;
+      maxviolation += model->col_upper_[col] * weight;
+    } else {
+      if (model->col_lower_[col] == -kHighsInf) {
+        skiprow = true;
+        break;
       }
-
-      indices.push_back(reducedcost.size());
-      positions.push_back(pos);
-      reducedcost.push_back(weight);
-      complementation.push_back(comp);
-      upper.push_back(ub);
+      comp = -1;
+      maxviolation += model->col_lower_[col] * weight;
+      weight = -weight;
     }
 
-    if (skiprow) {
-      stack.clear();
+    if (ub <= primal_feastol || weight <= primal_feastol) continue;
+
+    if (model->integrality_[col] == HighsVarType::kContinuous) {
+      continuouscontribution += weight * ub;
       continue;
     }
 
-    const double smallVal =
-        std::max(100 * primal_feastol, primal_feastol * double(maxviolation));
-    while (true) {
-      if (maxviolation - continuouscontribution <= smallVal || indices.empty())
-        break;
+    indices.push_back(reducedcost.size());
+    positions.push_back(pos);
+    reducedcost.push_back(weight);
+    complementation.push_back(comp);
+    upper.push_back(ub);
+  }
 
-      pdqsort(indices.begin(), indices.end(), [&](HighsInt i1, HighsInt i2) {
-        return std::make_pair(reducedcost[i1], i1) >
-               std::make_pair(reducedcost[i2], i2);
-      });
+  if (skiprow) {
+    stack.clear();
+    return false;
+  }
 
-      HighsCDouble lambda = maxviolation - continuouscontribution;
+  const double smallVal =
+      std::max(100 * primal_feastol, primal_feastol * double(maxviolation));
+  while (true) {
+    if (maxviolation - continuouscontribution <= smallVal || indices.empty())
+      break;
 
-      cover.clear();
-      cover.reserve(indices.size());
+    pdqsort(indices.begin(), indices.end(), [&](HighsInt i1, HighsInt i2) {
+      return std::make_pair(reducedcost[i1], i1) >
+             std::make_pair(reducedcost[i2], i2);
+    });
 
-      for (HighsInt i = indices.size() - 1; i >= 0; --i) {
-        double delta = upper[indices[i]] * reducedcost[indices[i]];
+    HighsCDouble lambda = maxviolation - continuouscontribution;
 
-        if (upper[indices[i]] <= 1000.0 && reducedcost[indices[i]] > smallVal &&
-            lambda - delta <= smallVal)
-          cover.push_back(indices[i]);
-        else
-          lambda -= delta;
-      }
+    cover.clear();
+    cover.reserve(indices.size());
 
-      if (cover.empty() || lambda <= smallVal) break;
-
-      HighsInt alpos = *std::min_element(
-          cover.begin(), cover.end(), [&](HighsInt i1, HighsInt i2) {
-            if (reducedcost[i1] <= 1e-3 || reducedcost[i2] <= 1e-3)
-              return reducedcost[i1] > reducedcost[i2];
-            return reducedcost[i1] < reducedcost[i2];
-          });
-
-      HighsInt coverend = cover.size();
-
-      double al = reducedcost[alpos];
-      coefs.resize(coverend);
-      double coverrhs =
-          std::max(std::ceil(double(lambda / al - primal_feastol)), 1.0);
-      HighsCDouble slackupper = -coverrhs;
-
-      double step = kHighsInf;
-      for (HighsInt i = 0; i != coverend; ++i) {
-        coefs[i] =
-            std::ceil(std::min(reducedcost[cover[i]], double(lambda)) / al -
-                      options->small_matrix_value);
-        slackupper += upper[cover[i]] * coefs[i];
-        step = std::min(step, reducedcost[cover[i]] / coefs[i]);
-      }
-      step = std::min(step, double(maxviolation / coverrhs));
-      maxviolation -= step * coverrhs;
-
-      HighsInt slackind = reducedcost.size();
-      reducedcost.push_back(step);
-      upper.push_back(double(slackupper));
-
-      for (HighsInt i = 0; i != coverend; ++i)
-        reducedcost[cover[i]] -= step * coefs[i];
-
-      indices.erase(std::remove_if(indices.begin(), indices.end(),
-                                   [&](HighsInt i) {
-                                     return reducedcost[i] <= primal_feastol;
-                                   }),
-                    indices.end());
-      indices.push_back(slackind);
+    for (HighsInt i = indices.size() - 1; i >= 0; --i) {
+      double delta = upper[indices[i]] * reducedcost[indices[i]];
+
+      if (upper[indices[i]] <= 1000.0 && reducedcost[indices[i]] > smallVal &&
+          lambda - delta <= smallVal)
+        cover.push_back(indices[i]);
+      else
+        lambda -= delta;
+    }
+
+    if (cover.empty() || lambda <= smallVal) break;
+
+    HighsInt alpos = *std::min_element(
+        cover.begin(), cover.end(), [&](HighsInt i1, HighsInt i2) {
+          if (reducedcost[i1] <= 1e-3 || reducedcost[i2] <= 1e-3)
+            return reducedcost[i1] > reducedcost[i2];
+          return reducedcost[i1] < reducedcost[i2];
+        });
+
+    HighsInt coverend = cover.size();
+
+    double al = reducedcost[alpos];
+    coefs.resize(coverend);
+    double coverrhs =
+        std::max(std::ceil(double(lambda / al - primal_feastol)), 1.0);
+    HighsCDouble slackupper = -coverrhs;
+
+    double step = kHighsInf;
+    for (HighsInt i = 0; i != coverend; ++i) {
+      coefs[i] =
+          std::ceil(std::min(reducedcost[cover[i]], double(lambda)) / al -
+                    options->small_matrix_value);
+      slackupper += upper[cover[i]] * coefs[i];
+      step = std::min(step, reducedcost[cover[i]] / coefs[i]);
     }
+    step = std::min(step, double(maxviolation / coverrhs));
+    maxviolation -= step * coverrhs;
 
-    double threshold = double(maxviolation + primal_feastol);
+    HighsInt slackind = reducedcost.size();
+    reducedcost.push_back(step);
+    upper.push_back(double(slackupper));
+
+    for (HighsInt i = 0; i != coverend; ++i)
+      reducedcost[cover[i]] -= step * coefs[i];
 
     indices.erase(std::remove_if(indices.begin(), indices.end(),
                                  [&](HighsInt i) {
-                                   return i >= (HighsInt)positions.size() ||
-                                          std::abs(reducedcost[i]) <= threshold;
+                                   return reducedcost[i] <= primal_feastol;
                                  }),
                   indices.end());
-    if (indices.empty()) continue;
+    indices.push_back(slackind);
+  }
 
-    if (scale == -1.0) {
-      HighsCDouble lhs = model->row_lower_[row];
-      for (HighsInt i : indices) {
-        double coefdelta = double(reducedcost[i] - maxviolation);
-        HighsInt pos = positions[i];
+  double threshold = double(maxviolation + primal_feastol);
 
-        if (complementation[i] == -1) {
-          lhs -= coefdelta * model->col_lower_[Acol[pos]];
-          addToMatrix(row, Acol[pos], -coefdelta);
-        } else {
-          lhs += coefdelta * model->col_upper_[Acol[pos]];
-          addToMatrix(row, Acol[pos], coefdelta);
-        }
+  indices.erase(std::remove_if(indices.begin(), indices.end(),
+                               [&](HighsInt i) {
+                                 return i >= (HighsInt)positions.size() ||
+                                        std::abs(reducedcost[i]) <= threshold;
+                               }),
+                indices.end());
+  if (indices.empty()) return false;
+
+  coefdelta.clear();
+  if (scale == -1.0) {
+    HighsCDouble lhs = model->row_lower_[row];
+    for (HighsInt i : indices) {
+      double delta = double(reducedcost[i] - maxviolation);
+      HighsInt pos = positions[i];
+
+      if (complementation[i] == -1) {
+        lhs -= delta * model->col_lower_[Acol[pos]];
+        coefdelta.emplace_back(Acol[pos], -delta);
+      } else {
+        lhs += delta * model->col_upper_[Acol[pos]];
+        coefdelta.emplace_back(Acol[pos], delta);
       }
+    }
 
-      model->row_lower_[row] = double(lhs);
-    } else {
-      HighsCDouble rhs = model->row_upper_[row];
-      for (HighsInt i : indices) {
-        double coefdelta = double(reducedcost[i] - maxviolation);
-        HighsInt pos = positions[i];
-
-        if (complementation[i] == -1) {
-          rhs += coefdelta * model->col_lower_[Acol[pos]];
-          addToMatrix(row, Acol[pos], coefdelta);
-        } else {
-          rhs -= coefdelta * model->col_upper_[Acol[pos]];
-          addToMatrix(row, Acol[pos], -coefdelta);
-        }
+    side = double(lhs);
+  } else {
+    HighsCDouble rhs = model->row_upper_[row];
+    for (HighsInt i : indices) {
+      double delta = double(reducedcost[i] - maxviolation);
+      HighsInt pos = positions[i];
+
+      if (complementation[i] == -1) {
+        rhs += delta * model->col_lower_[Acol[pos]];
+        coefdelta.emplace_back(Acol[pos], delta);
+      } else {
+        rhs -= delta * model->col_upper_[Acol[pos]];
+        coefdelta.emplace_back(Acol[pos], -delta);
       }
+    }
+
+    side = double(rhs);
+  }
+
+  return true;
+}
+
+HighsInt HPresolve::strengthenInequalities() {
+  // Strengthening an inequality only changes its own coefficients and
+  // side, and is computed from the row and the column bounds alone. So
+  // with several threads all rows are strengthened concurrently, and
+  // the changes are applied afterwards in the order of the rows. This
+  // gives the same result as strengthening the rows one at a time.
+  // This is the only concurrent pass of the presolve loop: the row and
+  // column rules change the bounds and matrix that the next rule reads
+  HighsInt numstrenghtened = 0;
+  auto applyStrengthening =
+      [&](HighsInt row,
+          const std::vector<std::pair<HighsInt, double>>& coefdelta,
+          double side) {
+        for (const std::pair<HighsInt, double>& delta : coefdelta)
+          addToMatrix(row, delta.first, delta.second);
+        if (model->row_lower_[row] != -kHighsInf)
+          model->row_lower_[row] = side;
+        else
+          model->row_upper_[row] = side;
+        numstrenghtened += coefdelta.size();
+      };
 
-      model->row_upper_[row] = double(rhs);
+  const HighsInt numThreads = highs::parallel::num_threads();
+  if (numThreads <= 1) {
+    StrengthenInequalityWorkspace workspace;
+    std::vector<std::pair<HighsInt, double>> coefdelta;
+    double side;
+    for (HighsInt row = 0; row != model->num_row_; ++row) {
+      if (strengthenInequality(row, workspace, coefdelta, side))
+        applyStrengthening(row, coefdelta, side);
     }
+    return numstrenghtened;
+  }
+
+  std::vector<std::vector<std::pair<HighsInt, double>>> rowCoefDelta(
+      model->num_row_);
+  std::vector<double> rowSide(model->num_row_);
+  std::vector<uint8_t> strengthened(model->num_row_);
+  highs::parallel::for_each(
+      0, model->num_row_,
+      [&](HighsInt start, HighsInt end) {
+        StrengthenInequalityWorkspace workspace;
+        for (HighsInt row = start; row != end; ++row)
+          strengthened[row] = strengthenInequality(
+              row, workspace, rowCoefDelta[row], rowSide[row]);
+      },
+      std::max(HighsInt{100}, model->num_row_ / (8 * numThreads)));
 
-    numstrenghtened += indices.size();
+  for (HighsInt row = 0; row != model->num_row_; ++row) {
+    if (strengthened[row])
+      applyStrengthening(row, rowCoefDelta[row], rowSide[row]);
   }
 
   return numstrenghtened;
@@ -249,6 +249,26 @@ class HPresolve {
 
   Result applyConflictGraphSubstitutions(HighsPostsolveStack& postsolve_stack);
 
+  // Work arrays for strengthening the coefficients of an inequality
+  struct StrengthenInequalityWorkspace {
+    std::vector<int8_t> complementation;
+    std::vector<double> reducedcost;
+    std::vector<double> upper;
+    std::vector<HighsInt> indices;
+    std::vector<HighsInt> positions;
+    std::vector<HighsInt> stack;
+    std::vector<double> coefs;
+    std::vector<HighsInt> cover;
+  };
+
+  // Computes the changes to the coefficients of an inequality row and its
+  // new side, without modifying the problem. Returns false if the row
+  // cannot be strengthened
+  bool strengthenInequality(HighsInt row,
+                            StrengthenInequalityWorkspace& workspace,
+                            std::vector<std::pair<HighsInt, double>>& coefdelta,
+                            double& side) const;
+
   Result fastPresolveLoop(HighsPostsolveStack& postsolve_stack);
 
   Result presolve(HighsPostsolveStack& postsolve_stack);
@@ -18,6 +18,7 @@
 #include "presolve/HighsSymmetry.h"
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 
 #include "mip/HighsCliqueTable.h"
@@ -26,6 +27,11 @@
 #include "pdqsort/pdqsort.h"
 #include "util/HighsDisjointSets.h"
 
+// graphs with at least this many columns are compared to the stored leaves
+// in parallel
+static constexpr HighsInt kMinColsForParallelGraphComparison = 5000;
+static constexpr HighsInt kGraphComparisonGrainSize = 1000;
+
 void HighsSymmetryDetection::removeFixPoints() {
   Gend.resize(numVertices);
   for (HighsInt i = 0; i < numVertices; ++i) {
@@ -919,11 +925,18 @@ bool HighsSymmetryDetection::partitionRefinement() {
     // if there are none there is nothing to refine
     if (refineStart == cellEnd) continue;
 
-    // sort the vertices that have updated hash values by their hash values
-    pdqsort(currentPartition.begin() + refineStart,
-            currentPartition.begin() + cellEnd, [&](HighsInt v1, HighsInt v2) {
-              return vertexHash[v1] < vertexHash[v2];
-            });
+    // gather the updated hash values into a contiguous buffer once and sort
+    // the vertices by them, instead of querying the hash table for every
+    // comparison; ties are broken by the vertex index
+    refinementHashes.clear();
+    refinementHashes.reserve(cellEnd - refineStart);
+    for (HighsInt i = refineStart; i != cellEnd; ++i) {
+      HighsInt vertex = currentPartition[i];
+      refinementHashes.emplace_back(*vertexHash.find(vertex), vertex);
+    }
+    pdqsort(refinementHashes.begin(), refinementHashes.end());
+    for (HighsInt i = refineStart; i != cellEnd; ++i)
+      currentPartition[i] = refinementHashes[i - refineStart].second;
 
     // if not all vertices have updated hash values directly create the first
     // new cell at the start of the range that we want to refine
@@ -947,11 +960,10 @@ bool HighsSymmetryDetection::partitionRefinement() {
     HighsInt i;
     assert(vertexHash.find(currentPartition[cellStart]) != nullptr);
     // store value of first hash
-    u64 lastHash = vertexHash[currentPartition[cellStart]];
+    u32 lastHash = refinementHashes[cellStart - refineStart].first;
     for (i = cellStart + 1; i < cellEnd; ++i) {
-      HighsInt vertex = currentPartition[i];
       // get this vertex hash value
-      u64 hash = vertexHash[vertex];
+      u32 hash = refinementHashes[i - refineStart].first;
 
       if (hash != lastHash) {
         // hash values do not match -> start of new cell
@@ -1373,31 +1385,66 @@ void HighsSymmetryDetection::switchToNextNode(HighsInt backtrackDepth) {
 bool HighsSymmetryDetection::compareCurrentGraph(
     const HighsHashTable<std::tuple<HighsInt, HighsInt, HighsUInt>>& otherGraph,
     HighsInt& wrongCell) {
-  for (HighsInt i = 0; i < numCol; ++i) {
+  // returns whether the neighborhood of column i matches the other graph
+  auto compareColumn = [&](HighsInt i) {
     HighsInt colCell = vertexToCell[i];
 
     for (HighsInt j = Gstart[i]; j != Gend[i]; ++j)
       if (!otherGraph.find(std::make_tuple(vertexToCell[Gedge[j].first],
-                                           colCell, Gedge[j].second))) {
-        // return which cell does not match in its neighborhood as this should
-        // have been detected with the hashing it can very rarely happen due to
-        // a hash collision. In such a case we want to backtrack to the last
-        // time where we targeted this particular cell. Otherwise we could spent
-        // a long time searching for a matching leave value until every
-        // combination is exhausted and for each leave in this subtree the graph
-        // comparison will fail on this edge.
-        wrongCell = colCell;
+                                           colCell, Gedge[j].second)))
         return false;
-      }
     for (HighsInt j = Gend[i]; j != Gstart[i + 1]; ++j)
       if (!otherGraph.find(
-              std::make_tuple(Gedge[j].first, colCell, Gedge[j].second))) {
-        wrongCell = colCell;
+              std::make_tuple(Gedge[j].first, colCell, Gedge[j].second)))
         return false;
+
+    return true;
+  };
+
+  // the first column whose neighborhood does not match, numCol if all match
+  HighsInt wrongCol = numCol;
+  if (numCol >= kMinColsForParallelGraphComparison &&
+      highs::parallel::num_threads() > 1) {
+    // the comparison only reads the graphs, so the columns are compared in
+    // parallel. Chunks keep the smallest mismatching column so that the
+    // result is the same as the one of the serial loop
+    std::atomic<HighsInt> firstWrongCol{numCol};
+    highs::parallel::for_each(
+        0, numCol,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt i = start; i < end; ++i) {
+            if (i >= firstWrongCol.load(std::memory_order_relaxed)) return;
+            if (compareColumn(i)) continue;
+
+            HighsInt current = firstWrongCol.load(std::memory_order_relaxed);
+            while (i < current && !firstWrongCol.compare_exchange_weak(
+                                      current, i, std::memory_order_relaxed))
+              ;
+            return;
+          }
+        },
+        kGraphComparisonGrainSize);
+    wrongCol = firstWrongCol.load(std::memory_order_relaxed);
+  } else {
+    for (HighsInt i = 0; i < numCol; ++i) {
+      if (!compareColumn(i)) {
+        wrongCol = i;
+        break;
       }
+    }
   }
 
-  return true;
+  if (wrongCol == numCol) return true;
+
+  // return which cell does not match in its neighborhood as this should
+  // have been detected with the hashing it can very rarely happen due to
+  // a hash collision. In such a case we want to backtrack to the last
+  // time where we targeted this particular cell. Otherwise we could spent
+  // a long time searching for a matching leave value until every
+  // combination is exhausted and for each leave in this subtree the graph
+  // comparison will fail on this edge.
+  wrongCell = vertexToCell[wrongCol];
+  return false;
 }
 
 bool HighsSymmetryDetection::isFromBinaryColumn(HighsInt pos) const {
@@ -169,6 +169,7 @@ class HighsSymmetryDetection {
   std::vector<HighsInt> automorphisms;
 
   std::vector<HighsInt> linkCompressionStack;
+  std::vector<std::pair<u32, HighsInt>> refinementHashes;
 
   std::vector<u32> currNodeCertificate;
   std::vector<u32> firstLeaveCertificate;
@@ -208,6 +209,9 @@ class HighsSymmetryDetection {
 
   void switchToNextNode(HighsInt backtrackDepth);
 
+  // compares the graph of the current leaf with a stored leaf graph. This
+  // is the only step of the detection that uses several threads, and only
+  // on large graphs: the search tree itself is explored serially
   bool compareCurrentGraph(
       const HighsHashTable<std::tuple<HighsInt, HighsInt, HighsUInt>>&
           otherGraph,
@@ -25,6 +25,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/HSimplexReport.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HighsSimd.h"
 
 using std::fabs;
 using std::max;
@@ -88,6 +89,7 @@ void HEkk::clearNlaInvertStatus() {
 void HEkk::clearEkkPointers() {
   this->options_ = NULL;
   this->timer_ = NULL;
+  this->interrupt_flag_ = nullptr;
 }
 
 void HEkk::clearEkkLp() {
@@ -349,17 +351,48 @@ void HEkk::updateStatus(LpAction action) {
       this->clearHotStart();
       //    this->invalidateBasisArtifacts();
       break;
-    case LpAction::kNewRows:
-      if (kExtendInvertWhenAddingRows) {
-        // Just clear Ekk data
-        this->clearEkkData();
-      } else {
-        // Clear everything
-        this->clear();
+    case LpAction::kNewNonbasicCols:
+      // The simplex basis, INVERT and DSE weights are retained, but
+      // the row-wise matrix and any data for the previous iterate
+      // must be recomputed
+      this->status_.has_ar_matrix = false;
+      this->status_.has_fresh_rebuild = false;
+      this->status_.has_dual_objective_value = false;
+      this->status_.has_primal_objective_value = false;
+      this->status_.has_dual_ray = false;
+      this->status_.has_primal_ray = false;
+      if (this->status_.has_nla) {
+        this->simplex_nla_.frozenBasisClearAllData();
+        this->simplex_nla_.simplex_iterate_.clear();
       }
+      this->info_.valid_backtracking_basis_ = false;
+      this->clearBadBasisChange();
+      this->clearHotStart();
+      break;
+    case LpAction::kNewRows:
+      this->clear();
       this->clearHotStart();
       //    this->invalidateBasisArtifacts();
       break;
+    case LpAction::kNewBasicRows:
+      // The simplex basis, INVERT and DSE weights have been extended,
+      // but the row-wise matrix and any data for the previous iterate
+      // must be recomputed
+      this->status_.has_ar_matrix = false;
+      this->status_.has_fresh_invert = false;
+      this->status_.has_fresh_rebuild = false;
+      this->status_.has_dual_objective_value = false;
+      this->status_.has_primal_objective_value = false;
+      this->status_.has_dual_ray = false;
+      this->status_.has_primal_ray = false;
+      if (this->status_.has_nla) {
+        this->simplex_nla_.frozenBasisClearAllData();
+        this->simplex_nla_.simplex_iterate_.clear();
+      }
+      this->info_.valid_backtracking_basis_ = false;
+      this->clearBadBasisChange();
+      this->clearHotStart();
+      break;
     case LpAction::kDelCols:
       this->clear();
       this->clearHotStart();
@@ -447,6 +480,7 @@ void HEkk::moveLp(HighsLpSolverObject& solver_object) {
   // HighsOptions and HighsTimer members of the Highs class that are
   // communicated by reference via the HighsLpSolverObject instance.
   this->setPointers(&solver_object.options_, &solver_object.timer_);
+  this->interrupt_flag_ = solver_object.interrupt_flag_;
   // Initialise Ekk if this has not been done. Ekk isn't initialised
   // if moveLp hasn't been called for this instance of HiGHS, or if
   // the Ekk instance is junked due to removing rows from the LP
@@ -1288,8 +1322,29 @@ void HEkk::addCols(const HighsLp& lp,
   //  }
   //  if (valid_simplex_lp)
   //    assert(ekk_instance_.lp_.dimensionsOk("addCols - simplex"));
+  //
+  // The new columns are nonbasic so, if the simplex basis has been
+  // extended to include them, the INVERT and DSE weights remain
+  // valid, and the next solve can start from the current iterate
+  const bool retain_invert =
+      this->status_.has_invert && this->status_.has_basis &&
+      (HighsInt)this->basis_.nonbasicFlag_.size() == lp.num_col_ + lp.num_row_;
   if (this->status_.has_nla) this->simplex_nla_.addCols(&lp);
-  this->updateStatus(LpAction::kNewCols);
+  if (retain_invert) {
+    // The indices of basic logicals have been shifted, so recompute
+    // the basis hash
+    this->basis_.hash = 0;
+    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+      HighsHashHelpers::sparse_combine(this->basis_.hash,
+                                       this->basis_.basicIndex_[iRow]);
+    // Update the number of columns in the simplex LP so that it's
+    // consistent with simplex basis information
+    this->lp_.num_col_ = lp.num_col_;
+    this->scattered_dual_edge_weight_.resize(lp.num_col_ + lp.num_row_);
+    this->updateStatus(LpAction::kNewNonbasicCols);
+  } else {
+    this->updateStatus(LpAction::kNewCols);
+  }
 }
 
 void HEkk::addRows(const HighsLp& lp,
@@ -1304,16 +1359,41 @@ void HEkk::addRows(const HighsLp& lp,
   //  }
   //  if (valid_simplex_lp)
   //    assert(ekk_instance_.lp_.dimensionsOk("addRows - simplex"));
-  if (kExtendInvertWhenAddingRows && this->status_.has_nla) {
+  //
+  // If the simplex basis has been extended by the basic slacks of the
+  // new rows, then the INVERT can be extended, and the DSE weights
+  // for the new rows computed, so the next solve can start from the
+  // current basis without reinversion
+  const HighsInt num_new_row = scaled_ar_matrix.num_row_;
+  const bool extend_invert =
+      this->status_.has_invert && this->status_.has_basis &&
+      this->options_->extend_invert_when_adding_rows &&
+      (HighsInt)this->basis_.basicIndex_.size() == lp.num_row_;
+  if (extend_invert) {
     this->simplex_nla_.addRows(&lp, &basis_.basicIndex_[0], &scaled_ar_matrix);
     setNlaPointersForTrans(lp);
-    this->debugNlaCheckInvert("HEkk::addRows - on entry",
-                              kHighsDebugLevelExpensive + 1);
+    this->debugNlaCheckInvert("HEkk::addRows - on entry");
+    for (HighsInt iRow = lp.num_row_ - num_new_row; iRow < lp.num_row_; iRow++)
+      HighsHashHelpers::sparse_combine(this->basis_.hash, lp.num_col_ + iRow);
   }
   // Update the number of rows in the simplex LP so that it's
   // consistent with simplex basis information
   this->lp_.num_row_ = lp.num_row_;
-  this->updateStatus(LpAction::kNewRows);
+  if (extend_invert) {
+    if (this->status_.has_dual_steepest_edge_weights) {
+      this->dual_edge_weight_.resize(lp.num_row_);
+      this->scattered_dual_edge_weight_.resize(lp.num_col_ + lp.num_row_);
+      HVector row_ep;
+      row_ep.setup(lp.num_row_);
+      for (HighsInt iRow = lp.num_row_ - num_new_row; iRow < lp.num_row_;
+           iRow++)
+        this->dual_edge_weight_[iRow] =
+            computeDualSteepestEdgeWeight(iRow, row_ep);
+    }
+    this->updateStatus(LpAction::kNewBasicRows);
+  } else {
+    this->updateStatus(LpAction::kNewRows);
+  }
 }
 
 void HEkk::deleteCols(const HighsIndexCollection& index_collection) {
@@ -2226,6 +2306,15 @@ void HEkk::updateDualSteepestEdgeWeights(
   const bool use_row_indices =
       simplex_nla_.sparseLoopStyle(column_count, num_row, to_entry);
   const bool convert_to_scaled_space = !simplex_in_scaled_space_;
+  if (!convert_to_scaled_space && !DSE_check) {
+    // No scaling to apply, so use the vectorised update
+    highs::simd::updateEdgeWeights(
+        use_row_indices ? variable_index : nullptr, to_entry, column_array,
+        dual_steepest_edge_array, new_pivotal_edge_weight, Kai,
+        kMinDualSteepestEdgeWeight, dual_edge_weight_.data());
+    analysis_.simplexTimerStop(DseUpdateWeightClock);
+    return;
+  }
   for (HighsInt iEntry = 0; iEntry < to_entry; iEntry++) {
     const HighsInt iRow = use_row_indices ? variable_index[iEntry] : iEntry;
     double aa_iRow = column_array[iRow];
@@ -3461,6 +3550,12 @@ bool HEkk::bailoutOnTimeIterations() {
   } else if (iteration_count_ >= options_->simplex_iteration_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kIterationLimit;
+  } else if (interrupt_flag_ &&
+             interrupt_flag_->load(std::memory_order_relaxed)) {
+    // Another solver has finished first, so the outcome of this solve
+    // is not required: stop as if the time limit had been reached
+    solve_bailout_ = true;
+    model_status_ = HighsModelStatus::kTimeLimit;
   }
   return solve_bailout_;
 }
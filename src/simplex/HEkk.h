@@ -16,6 +16,8 @@
 #ifndef SIMPLEX_HEKK_H_
 #define SIMPLEX_HEKK_H_
 
+#include <atomic>
+
 #include "simplex/HSimplexNla.h"
 #include "simplex/HighsSimplexAnalysis.h"
 #include "util/HSet.h"
@@ -135,6 +137,8 @@ class HEkk {
   // Data members
   HighsOptions* options_;
   HighsTimer* timer_;
+  // Set by another thread when this solve is no longer required
+  const std::atomic<bool>* interrupt_flag_ = nullptr;
   HighsSimplexAnalysis analysis_;
 
   HighsLp lp_;
@@ -1197,14 +1197,28 @@ void HEkkDual::iterate() {
   if (isBadBasisChange()) return;
 
   analysis->simplexTimerStart(IterateFtranClock);
+  // With more than one thread, the DSE FTRAN runs concurrently with
+  // FTRAN-BFRT and FTRAN, unless the clocks or operation records
+  // that they share are being used
+  const bool concurrent_ftran_dse =
+      edge_weight_mode == EdgeWeightMode::kSteepestEdge &&
+      highs::parallel::num_threads() > 1 && !analysis->analyse_simplex_time &&
+      !analysis->analyse_factor_time &&
+      !analysis->analyse_simplex_summary_data;
+  if (concurrent_ftran_dse)
+    highs::parallel::spawn([&]() { updateFtranDSE(&row_ep); });
+
   updateFtranBFRT();
 
   // updateFtran(); computes the pivotal column in the data structure "column"
   updateFtran();
 
   // updateFtranDSE performs the DSE FTRAN on pi_p
-  if (edge_weight_mode == EdgeWeightMode::kSteepestEdge)
+  if (concurrent_ftran_dse) {
+    highs::parallel::sync();
+  } else if (edge_weight_mode == EdgeWeightMode::kSteepestEdge) {
     updateFtranDSE(&row_ep);
+  }
   analysis->simplexTimerStop(IterateFtranClock);
 
   // updateVerify() Checks row-wise pivot against column-wise pivot for
@@ -1457,6 +1471,12 @@ void HEkkDual::chooseRow() {
   }
   // Recover the infeasibility of any taboo rows
   ekk_instance_.unapplyTabooRowOut(dualRHS.work_infeasibility);
+  if (dualRHS.use_infeas_heap) {
+    // Taboo rows at the top of the heap will have been removed
+    for (const HighsSimplexBadBasisChangeRecord& record :
+         ekk_instance_.bad_basis_change_)
+      if (record.taboo) dualRHS.updateInfeasHeap(record.row_out);
+  }
 
   // Index of row to leave the basis has been found
   //
@@ -1846,22 +1866,24 @@ void HEkkDual::chooseColumnSlice(HVector* row_ep) {
     analysis->operationRecordAfter(kSimplexNlaPriceAp, row_ap_count);
   }
 
-  // Join CC1 results here
+  // Join CC1 results here, leaving the candidates in the slices
+  HighsInt num_candidate = dualRow.workCount;
   for (HighsInt i = 0; i < slice_num; i++) {
-    dualRow.chooseJoinpack(&slice_dualRow[i]);
+    num_candidate += slice_dualRow[i].workCount;
+    dualRow.workTheta = std::min(dualRow.workTheta, slice_dualRow[i].workTheta);
   }
 
   analysis->simplexTimerStop(PriceChuzc1Clock);
 
   // Infeasible we created before
   variable_in = -1;
-  if (dualRow.workTheta <= 0 || dualRow.workCount == 0) {
+  if (dualRow.workTheta <= 0 || num_candidate == 0) {
     rebuild_reason = kRebuildReasonPossiblyDualUnbounded;
     return;
   }
 
   // Choose column 2, This only happens if didn't go out
-  HighsInt return_code = dualRow.chooseFinal();
+  HighsInt return_code = dualRow.chooseFinalSlice(slice_num, slice_dualRow);
   if (return_code) {
     // Only returns -1, if not zero
     assert(return_code == -1);
@@ -2269,6 +2291,8 @@ void HEkkDual::initialiseDevexFramework() {
   // this Devex framework, increment the number of Devex frameworks
   // and indicate that there's no need for a new Devex framework
   ekk_instance_.dual_edge_weight_.assign(solver_num_row, 1.0);
+  // All the merits for CHUZR change
+  if (dualRHS.use_infeas_heap) dualRHS.createInfeasHeap();
   num_devex_iterations = 0;
   new_devex_framework = false;
   minor_new_devex_framework = false;
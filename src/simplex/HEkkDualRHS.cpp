@@ -38,6 +38,7 @@ void HEkkDualRHS::setup() {
   work_infeasibility.resize(numRow);
   partNum = 0;
   partSwitch = 0;
+  use_infeas_heap = false;
   analysis = &ekk_instance_.analysis_;
 }
 
@@ -47,7 +48,7 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
   // for code reproducibility!! Never mind if we're not timing the random number
   // call!!
   // HighsInt random = ekk_instance_.random_.integer();
-  if (workCount == 0) {
+  if (workCount == 0 && !use_infeas_heap) {
     *chIndex = -1;
     return;
   }
@@ -61,7 +62,21 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
   }
 
   std::vector<double>& edge_weight = ekk_instance_.dual_edge_weight_;
-  if (workCount < 0) {
+  if (use_infeas_heap) {
+    // HEAP mode: take the row at the top of the heap, unless its
+    // merit has changed since it was placed, in which case it is
+    // placed again
+    HighsInt bestIndex = -1;
+    while (!heap_row.empty()) {
+      const HighsInt iRow = heap_row[0];
+      if (heap_merit[0] == infeasMerit(iRow)) {
+        bestIndex = iRow;
+        break;
+      }
+      updateInfeasHeap(iRow);
+    }
+    *chIndex = bestIndex;
+  } else if (workCount < 0) {
     // DENSE mode
     const HighsInt numRow = -workCount;
     HighsInt randomStart = ekk_instance_.random_.integer(numRow);
@@ -370,12 +385,29 @@ void HEkkDualRHS::updatePivots(const HighsInt iRow, const double value) {
     work_infeasibility[iRow] = primal_infeasibility * primal_infeasibility;
   else
     work_infeasibility[iRow] = fabs(primal_infeasibility);
+  if (use_infeas_heap) updateInfeasHeap(iRow);
 }
 
 void HEkkDualRHS::updateInfeasList(HVector* column) {
   const HighsInt columnCount = column->count;
   const HighsInt* variable_index = &column->index[0];
 
+  if (use_infeas_heap) {
+    // HEAP mode: update the merits of the rows whose primal values
+    // (and edge weights) have changed, or create the heap again if
+    // there are many of them
+    analysis->simplexTimerStart(UpdatePrimalClock);
+    const HighsInt numRow = ekk_instance_.lp_.num_row_;
+    if (columnCount < 0 || columnCount > kInfeasHeapRebuildDensity * numRow) {
+      createInfeasHeap();
+    } else {
+      for (HighsInt i = 0; i < columnCount; i++)
+        updateInfeasHeap(variable_index[i]);
+    }
+    analysis->simplexTimerStop(UpdatePrimalClock);
+    return;
+  }
+
   // DENSE mode: disabled
   if (workCount < 0) return;
 
@@ -437,6 +469,18 @@ void HEkkDualRHS::createInfeasList(double columnDensity) {
   HighsInt numRow = ekk_instance_.lp_.num_row_;
   double* dwork = &ekk_instance_.scattered_dual_edge_weight_[0];
 
+  // 0. Use the heap of merits rather than the list, unless CHUZR is
+  //    multiple, since this uses the list
+  use_infeas_heap =
+      ekk_instance_.options_->dual_simplex_chuzr_heap &&
+      ekk_instance_.info_.simplex_strategy != kSimplexStrategyDualMulti;
+  if (use_infeas_heap) {
+    workCount = 0;
+    workCutoff = 0;
+    createInfeasHeap();
+    return;
+  }
+
   // 1. Build the full list
   fill_n(&workMark[0], numRow, 0);
   workCount = 0;
@@ -497,6 +541,97 @@ void HEkkDualRHS::createInfeasList(double columnDensity) {
   }
 }
 
+void HEkkDualRHS::createInfeasHeap() {
+  const HighsInt numRow = ekk_instance_.lp_.num_row_;
+  heap_row.clear();
+  heap_merit.clear();
+  heap_position.assign(numRow, -1);
+  for (HighsInt iRow = 0; iRow < numRow; iRow++) {
+    const double merit = infeasMerit(iRow);
+    if (merit <= 0) continue;
+    heap_position[iRow] = heap_row.size();
+    heap_row.push_back(iRow);
+    heap_merit.push_back(merit);
+  }
+  for (HighsInt position = (HighsInt)heap_row.size() / 2 - 1; position >= 0;
+       position--)
+    infeasHeapDown(position);
+}
+
+void HEkkDualRHS::updateInfeasHeap(const HighsInt iRow) {
+  const double merit = infeasMerit(iRow);
+  const HighsInt position = heap_position[iRow];
+  if (position < 0) {
+    // Add the row if it has become infeasible
+    if (merit <= 0) return;
+    heap_row.push_back(iRow);
+    heap_merit.push_back(merit);
+    heap_position[iRow] = heap_row.size() - 1;
+    infeasHeapUp(heap_row.size() - 1);
+    return;
+  }
+  if (merit <= 0) {
+    // Remove the row, replacing it by the last entry of the heap
+    heap_position[iRow] = -1;
+    const HighsInt last_row = heap_row.back();
+    const double last_merit = heap_merit.back();
+    heap_row.pop_back();
+    heap_merit.pop_back();
+    if (position == (HighsInt)heap_row.size()) return;
+    infeasHeapPlace(position, last_row, last_merit);
+    infeasHeapUp(position);
+    infeasHeapDown(heap_position[last_row]);
+    return;
+  }
+  const double previous_merit = heap_merit[position];
+  heap_merit[position] = merit;
+  if (merit > previous_merit) {
+    infeasHeapUp(position);
+  } else if (merit < previous_merit) {
+    infeasHeapDown(position);
+  }
+}
+
+double HEkkDualRHS::infeasMerit(const HighsInt iRow) const {
+  if (work_infeasibility[iRow] <= kHighsZero) return 0;
+  return work_infeasibility[iRow] / ekk_instance_.dual_edge_weight_[iRow];
+}
+
+void HEkkDualRHS::infeasHeapUp(HighsInt position) {
+  const HighsInt iRow = heap_row[position];
+  const double merit = heap_merit[position];
+  while (position > 0) {
+    const HighsInt parent = (position - 1) / 2;
+    if (heap_merit[parent] >= merit) break;
+    infeasHeapPlace(position, heap_row[parent], heap_merit[parent]);
+    position = parent;
+  }
+  infeasHeapPlace(position, iRow, merit);
+}
+
+void HEkkDualRHS::infeasHeapDown(HighsInt position) {
+  const HighsInt heap_size = heap_row.size();
+  const HighsInt iRow = heap_row[position];
+  const double merit = heap_merit[position];
+  for (;;) {
+    HighsInt child = 2 * position + 1;
+    if (child >= heap_size) break;
+    if (child + 1 < heap_size && heap_merit[child + 1] > heap_merit[child])
+      child++;
+    if (heap_merit[child] <= merit) break;
+    infeasHeapPlace(position, heap_row[child], heap_merit[child]);
+    position = child;
+  }
+  infeasHeapPlace(position, iRow, merit);
+}
+
+void HEkkDualRHS::infeasHeapPlace(const HighsInt position, const HighsInt iRow,
+                                  const double merit) {
+  heap_row[position] = iRow;
+  heap_merit[position] = merit;
+  heap_position[iRow] = position;
+}
+
 void HEkkDualRHS::assessOptimality() {
   HighsInt num_work_infeasibilities = 0;
   double max_work_infeasibility = 0;
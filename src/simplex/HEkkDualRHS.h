@@ -21,6 +21,10 @@
 #include "simplex/HEkk.h"
 #include "util/HVector.h"
 
+// Density of the change in the primal values above which the max-heap
+// of merits is created again, rather than updated
+const double kInfeasHeapRebuildDensity = 0.1;
+
 /**
  * @brief Dual simplex optimality test for HiGHS
  *
@@ -112,6 +116,19 @@ class HEkkDualRHS {
    */
   void createArrayOfPrimalInfeasibilities();
 
+  /**
+   * @brief Create the max-heap of the merits of the primal
+   * infeasibilities, for CHUZR in O(log numRow)
+   */
+  void createInfeasHeap();
+
+  /**
+   * @brief Update the position of a row in the max-heap of merits
+   * after its primal infeasibility or edge weight has changed
+   */
+  void updateInfeasHeap(const HighsInt iRow  //!< Row whose merit has changed
+  );
+
   void assessOptimality();
 
   // References:
@@ -127,6 +144,12 @@ class HEkkDualRHS {
       workIndex;  //!< List of rows with greatest primal infeasibilities
   std::vector<double> work_infeasibility;
 
+  bool use_infeas_heap = false;  //!< Use the max-heap of merits for CHUZR
+  std::vector<HighsInt> heap_row;  //!< Rows in the max-heap of merits
+  std::vector<double> heap_merit;  //!< Merits of the rows in the max-heap
+  std::vector<HighsInt>
+      heap_position;  //!< Position of each row in the max-heap, or -1
+
   HighsInt partNum;
   HighsInt partNumRow;
   HighsInt partNumCol;
@@ -134,6 +157,13 @@ class HEkkDualRHS {
   HighsInt partSwitch;
   std::vector<HighsInt> workPartition;
   HighsSimplexAnalysis* analysis;
+
+ private:
+  double infeasMerit(const HighsInt iRow) const;
+  void infeasHeapUp(HighsInt position);
+  void infeasHeapDown(HighsInt position);
+  void infeasHeapPlace(const HighsInt position, const HighsInt iRow,
+                       const double merit);
 };
 
 #endif /* SIMPLEX_HEKKDUALRHS_H_ */
@@ -18,6 +18,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "simplex/HSimplexDebug.h"
 #include "simplex/SimplexTimer.h"
@@ -29,6 +30,29 @@ using std::min;
 using std::pair;
 using std::set;
 
+// Adds a change to a total held in HighsCDouble, which would become NaN
+// when an infinite range is added, so infinite totals are kept as such
+static void addTotalChange(HighsCDouble& totalChange,
+                           const HighsCDouble change) {
+  if (double(totalChange) < kHighsInf && double(change) < kHighsInf)
+    totalChange += change;
+  else
+    totalChange = kHighsInf;
+}
+
+// Whether comparing the running sum of count nonnegative changes, as
+// accumulated in double by chooseFinal, with totalDelta certainly
+// gives the same result as comparing totalChange, their sum held in
+// HighsCDouble. The error of the running sum is at most count *
+// kHighsMacheps / 2 relative to the sum
+static bool totalChangeCompareIsExact(const HighsCDouble totalChange,
+                                      const HighsInt count,
+                                      const double totalDelta) {
+  const double sum = double(totalChange);
+  if (sum >= kHighsInf) return true;
+  return std::fabs(sum - totalDelta) > (count + 1) * kHighsMacheps * sum;
+}
+
 void HEkkDualRow::setupSlice(HighsInt size) {
   workSize = size;
   workMove = &ekk_instance_.basis_.nonbasicMove_[0];
@@ -319,6 +343,273 @@ HighsInt HEkkDualRow::chooseFinal() {
   return 0;
 }
 
+HighsInt HEkkDualRow::chooseFinalSlice(const HighsInt slice_num,
+                                       std::vector<HEkkDualRow>& slice_row) {
+  /**
+   * Chooses the entering variable via BFRT and EXPAND, as
+   * chooseFinal with the quadratic sort, but with the candidates
+   * held by this row (for row_ep) and the slices of row_ap
+   *
+   * Each row reduces and groups its own candidates with the
+   * selectTheta of the pass, and the changes and remaining ratios of
+   * the rows are then combined in row order. Only the candidates in
+   * the groups are gathered into workData. If a comparison of the
+   * combined values might not be decided as by the running sum and
+   * running minimum of chooseFinal, the rows are joined and
+   * chooseFinal is used
+   */
+  const HighsInt num_part = slice_num + 1;
+  auto part = [&](const HighsInt iPart) -> HEkkDualRow& {
+    return iPart == 0 ? *this : slice_row[iPart - 1];
+  };
+  std::vector<HighsInt> part_start(num_part + 1, 0);
+  std::vector<HighsInt> part_count(num_part);
+  std::vector<HighsCDouble> part_change(num_part);
+  std::vector<double> part_remain_theta(num_part);
+  std::vector<double> part_next_theta(num_part);
+  HighsInt fullCount = 0;
+  for (HighsInt iPart = 0; iPart < num_part; iPart++) {
+    HEkkDualRow& row = part(iPart);
+    part_count[iPart] = row.workCount;
+    fullCount += row.workCount;
+    part_start[iPart + 1] = fullCount;
+    row.workCount = 0;
+    workTheta = min(workTheta, row.workTheta);
+  }
+  const bool parallel_group = fullCount >= kParallelChuzcMinCount &&
+                              highs::parallel::num_threads() > 1;
+
+  // Keep the candidates in the order of the joined rows, in case
+  // chooseFinal has to be used
+  auto copyParts = [&](HighsInt from_part, HighsInt to_part) {
+    for (HighsInt iPart = from_part; iPart < to_part; iPart++)
+      std::copy(part(iPart).workData.begin(),
+                part(iPart).workData.begin() + part_count[iPart],
+                original_workData.begin() + part_start[iPart]);
+  };
+  original_workData.resize(fullCount);
+  if (parallel_group)
+    highs::parallel::for_each(0, num_part, copyParts, 1);
+  else
+    copyParts(0, num_part);
+  const HighsInt joinedCount = fullCount;
+  auto chooseFinalJoined = [&]() {
+    workCount = joinedCount;
+    std::copy(original_workData.begin(), original_workData.begin() + workCount,
+              workData.begin());
+    return chooseFinal();
+  };
+
+  // Group the candidates of each row for selectTheta, returning the
+  // number of candidates in the groups
+  auto groupParts = [&](const double selectTheta, const bool remain) {
+    auto groupPart = [&](HighsInt from_part, HighsInt to_part) {
+      for (HighsInt iPart = from_part; iPart < to_part; iPart++) {
+        HEkkDualRow& row = part(iPart);
+        part_change[iPart] = 0.0;
+        part_remain_theta[iPart] = kInitialRemainTheta;
+        part_next_theta[iPart] = kInitialRemainTheta;
+        row.workCount += row.chooseGroup(
+            row.workCount, part_count[iPart], selectTheta,
+            part_change[iPart], remain ? &part_remain_theta[iPart] : nullptr,
+            remain ? &part_next_theta[iPart] : nullptr);
+      }
+    };
+    if (parallel_group)
+      highs::parallel::for_each(0, num_part, groupPart, 1);
+    else
+      groupPart(0, num_part);
+    HighsInt count = 0;
+    for (HighsInt iPart = 0; iPart < num_part; iPart++)
+      count += part(iPart).workCount;
+    return count;
+  };
+
+  // 1. Reduce by large step BFRT
+  analysis->simplexTimerStart(Chuzc3Clock);
+  const double totalDelta = fabs(workDelta);
+  HighsCDouble totalChange = 0.0;
+  double selectTheta = 10 * workTheta + 1e-7;
+  for (;;) {
+    const HighsInt count = groupParts(selectTheta, false);
+    for (HighsInt iPart = 0; iPart < num_part; iPart++)
+      addTotalChange(totalChange, part_change[iPart]);
+    selectTheta *= 10;
+    if (count == fullCount) break;
+    if (!totalChangeCompareIsExact(totalChange, count, totalDelta)) {
+      analysis->simplexTimerStop(Chuzc3Clock);
+      return chooseFinalJoined();
+    }
+    if (double(totalChange) >= totalDelta) {
+      fullCount = count;
+      break;
+    }
+  }
+  for (HighsInt iPart = 0; iPart < num_part; iPart++) {
+    HEkkDualRow& row = part(iPart);
+    part_count[iPart] = row.workCount;
+    row.workCount = 0;
+    row.workGroup.assign(1, 0);
+  }
+  analysis->simplexTimerStop(Chuzc3Clock);
+
+  // 2. Choose by small step BFRT
+  analysis->simplexTimerStart(Chuzc4Clock);
+  analysis->simplexTimerStart(Chuzc4a0Clock);
+  totalChange = kInitialTotalChange;
+  selectTheta = workTheta;
+  HighsInt prev_count = 0;
+  double remainTheta = kInitialRemainTheta;
+  double prev_remainTheta = kInitialRemainTheta;
+  double prev_selectTheta = selectTheta;
+  bool choose_ok = true;
+  while (selectTheta < kMaxSelectTheta) {
+    const HighsInt count = groupParts(selectTheta, true);
+    // The running minimum of chooseFinal gives the least relaxed
+    // breakpoint, unless a greater one is within rounding of it
+    remainTheta = kInitialRemainTheta;
+    double nextTheta = kInitialRemainTheta;
+    for (HighsInt iPart = 0; iPart < num_part; iPart++) {
+      HEkkDualRow& row = part(iPart);
+      row.workGroup.push_back(row.workCount);
+      addTotalChange(totalChange, part_change[iPart]);
+      for (const double theta :
+           {part_remain_theta[iPart], part_next_theta[iPart]}) {
+        if (theta < remainTheta) {
+          nextTheta = remainTheta;
+          remainTheta = theta;
+        } else if (theta > remainTheta && theta < nextTheta) {
+          nextTheta = theta;
+        }
+      }
+    }
+    if (remainTheta < kInitialRemainTheta &&
+        nextTheta <= remainTheta * (1 + 4 * kHighsMacheps)) {
+      analysis->simplexTimerStop(Chuzc4a0Clock);
+      analysis->simplexTimerStop(Chuzc4Clock);
+      return chooseFinalJoined();
+    }
+    selectTheta = remainTheta;
+    // Check for no change in this loop - to prevent infinite loop
+    if ((count == prev_count) && (prev_selectTheta == selectTheta) &&
+        (prev_remainTheta == remainTheta)) {
+      choose_ok = false;
+      break;
+    }
+    prev_count = count;
+    prev_remainTheta = remainTheta;
+    prev_selectTheta = selectTheta;
+    if (count == fullCount) break;
+    // The running sum of chooseFinal also includes kInitialTotalChange
+    if (!totalChangeCompareIsExact(totalChange, count + 1, totalDelta)) {
+      analysis->simplexTimerStop(Chuzc4a0Clock);
+      analysis->simplexTimerStop(Chuzc4Clock);
+      return chooseFinalJoined();
+    }
+    if (double(totalChange) >= totalDelta) break;
+  }
+  analysis->num_quad_chuzc++;
+  analysis->sum_quad_chuzc_size += fullCount;
+  analysis->max_quad_chuzc_size =
+      max(fullCount, analysis->max_quad_chuzc_size);
+
+  // Gather the groups into workData, taking each group from the rows
+  // in order
+  const HighsInt num_group = (HighsInt)workGroup.size() - 1;
+  sorted_workData.resize(fullCount);
+  alt_workGroup.assign(1, 0);
+  HighsInt count = 0;
+  for (HighsInt iGroup = 0; iGroup < num_group; iGroup++) {
+    for (HighsInt iPart = 0; iPart < num_part; iPart++) {
+      const HEkkDualRow& row = part(iPart);
+      for (HighsInt i = row.workGroup[iGroup]; i < row.workGroup[iGroup + 1];
+           i++)
+        sorted_workData[count++] = row.workData[i];
+    }
+    alt_workGroup.push_back(count);
+  }
+  workCount = count;
+  workGroup.swap(alt_workGroup);
+  std::copy(sorted_workData.begin(), sorted_workData.begin() + workCount,
+            workData.begin());
+  analysis->simplexTimerStop(Chuzc4a0Clock);
+  if (!choose_ok || num_group <= 0) {
+    HighsInt num_var = ekk_instance_.lp_.num_col_ + ekk_instance_.lp_.num_row_;
+    if (!choose_ok) {
+      debugDualChuzcFailQuad0(*ekk_instance_.options_, workCount, workData,
+                              num_var, workDual, selectTheta, remainTheta,
+                              true);
+    } else {
+      debugDualChuzcFailQuad1(*ekk_instance_.options_, workCount, workData,
+                              num_var, workDual, selectTheta, true);
+    }
+    analysis->simplexTimerStop(Chuzc4Clock);
+    return -1;
+  }
+
+  // 3. Choose large alpha
+  analysis->simplexTimerStart(Chuzc4bClock);
+  HighsInt breakIndex;
+  HighsInt breakGroup;
+  chooseFinalLargeAlpha(breakIndex, breakGroup, workCount, workData,
+                        workGroup);
+  analysis->simplexTimerStop(Chuzc4bClock);
+  analysis->simplexTimerStart(Chuzc4cClock);
+  const HighsInt move_out = workDelta < 0 ? -1 : 1;
+  assert(breakIndex >= 0);
+  workPivot = workData[breakIndex].first;
+  workAlpha = workData[breakIndex].second * move_out * workMove[workPivot];
+  if (workDual[workPivot] * workMove[workPivot] > 0) {
+    workTheta = workDual[workPivot] / workAlpha;
+  } else {
+    workTheta = 0;
+  }
+  analysis->simplexTimerStop(Chuzc4cClock);
+
+  // 4. Determine BFRT flip index: flip all
+  analysis->simplexTimerStart(Chuzc4dClock);
+  workCount = 0;
+  for (HighsInt i = 0; i < workGroup[breakGroup]; i++) {
+    const HighsInt iCol = workData[i].first;
+    const HighsInt move = workMove[iCol];
+    workData[workCount++] = make_pair(iCol, move * workRange[iCol]);
+  }
+  if (workTheta == 0) workCount = 0;
+  analysis->simplexTimerStop(Chuzc4dClock);
+
+  analysis->simplexTimerStart(Chuzc4eClock);
+  pdqsort(workData.begin(), workData.begin() + workCount);
+  analysis->simplexTimerStop(Chuzc4eClock);
+  analysis->simplexTimerStop(Chuzc4Clock);
+  return 0;
+}
+
+HighsInt HEkkDualRow::chooseGroup(const HighsInt from_i, const HighsInt to_i,
+                                  const double selectTheta,
+                                  HighsCDouble& totalChange,
+                                  double* remainTheta, double* nextTheta) {
+  const double Td = ekk_instance_.options_->dual_feasibility_tolerance;
+  HighsInt count = from_i;
+  for (HighsInt i = from_i; i < to_i; i++) {
+    const HighsInt iCol = workData[i].first;
+    const double value = workData[i].second;
+    const double dual = workMove[iCol] * workDual[iCol];
+    if (dual <= selectTheta * value) {
+      swap(workData[count++], workData[i]);
+      addTotalChange(totalChange, value * workRange[iCol]);
+    } else if (remainTheta) {
+      const double theta = (dual + Td) / value;
+      if (theta < *remainTheta) {
+        *nextTheta = *remainTheta;
+        *remainTheta = theta;
+      } else if (theta > *remainTheta && theta < *nextTheta) {
+        *nextTheta = theta;
+      }
+    }
+  }
+  return count - from_i;
+}
+
 bool HEkkDualRow::chooseFinalWorkGroupQuad() {
   const double Td = ekk_instance_.options_->dual_feasibility_tolerance;
   HighsInt fullCount = workCount;
@@ -21,10 +21,14 @@
 
 #include "simplex/HEkk.h"
 #include "util/HVector.h"
+#include "util/HighsCDouble.h"
 
 const double kInitialTotalChange = 1e-12;
 const double kInitialRemainTheta = 1e100;
 const double kMaxSelectTheta = 1e18;
+// Minimum number of CHUZC candidates for the slices of the pivotal
+// row to be reduced and grouped in parallel
+const HighsInt kParallelChuzcMinCount = 1000;
 
 /**
  * @brief Dual simplex ratio test for HiGHS
@@ -86,6 +90,33 @@ class HEkkDualRow {
    */
   HighsInt chooseFinal();
 
+  /**
+   * @brief Chooses the entering variable via BFRT and EXPAND when the
+   * candidates are held by this row and the slices of the pivotal
+   * row, without joining them
+   *
+   * The candidates of each row are reduced and grouped independently,
+   * in parallel if there are enough of them, with the changes and
+   * ratios combined in row order. The changes are summed in
+   * HighsCDouble. Whenever the running sum or running minimum of
+   * chooseFinal might compare differently, because of its rounding,
+   * the rows are joined and chooseFinal is used, so the pivot and
+   * flips are always those of chooseFinal
+   */
+  HighsInt chooseFinalSlice(const HighsInt slice_num,
+                            std::vector<HEkkDualRow>& slice_row);
+
+  /**
+   * @brief Moves the candidates in [from_i, to_i) of workData whose
+   * breakpoint is at most selectTheta to the front, returning their
+   * number. Their change is added to totalChange and, if remainTheta
+   * is not null, it is reduced to the least relaxed breakpoint of the
+   * others and nextTheta to the least one that is greater
+   */
+  HighsInt chooseGroup(const HighsInt from_i, const HighsInt to_i,
+                       const double selectTheta, HighsCDouble& totalChange,
+                       double* remainTheta, double* nextTheta);
+
   /**
    * @brief Identifies the groups of degenerate nodes in BFRT after a
    * heap sort of ratios
@@ -1943,8 +1943,8 @@ void HEkkPrimal::considerInfeasibleValueIn() {
 }
 
 void HEkkPrimal::phase2UpdatePrimal(const bool initialise) {
-  static double max_max_local_primal_infeasibility;
-  static double max_max_ignored_violation;
+  static thread_local double max_max_local_primal_infeasibility;
+  static thread_local double max_max_ignored_violation;
   if (initialise) {
     max_max_local_primal_infeasibility = 0;
     max_max_ignored_violation = 0;
@@ -2047,7 +2047,7 @@ void HEkkPrimal::phase2UpdatePrimal(const bool initialise) {
 bool HEkkPrimal::correctPrimal(const bool initialise) {
   if (primal_correction_strategy == kSimplexPrimalCorrectionStrategyNone)
     return true;
-  static double max_max_primal_correction;
+  static thread_local double max_max_primal_correction;
   if (initialise) {
     max_max_primal_correction = 0;
     return true;
@@ -42,6 +42,9 @@ void HSimplexNla::setup(const HighsLp* lp, HighsInt* basic_index,
       &factor_a_matrix->value_[0], this->basic_index_, factor_pivot_threshold,
       this->options_->factor_pivot_tolerance, this->options_->highs_debug_level,
       &(this->options_->log_options));
+  this->factor_.setUseLevelSchedule(this->options_->simplex_parallel_solve);
+  this->factor_.setUseParallelKernel(this->options_->simplex_parallel_factor);
+  this->factor_.setUseDenseKernel(this->options_->factor_dense_kernel);
   assert(debugCheckData("After HSimplexNla::setup") == HighsDebugStatus::kOk);
 }
 
@@ -65,7 +68,12 @@ void HSimplexNla::setPointers(const HighsLp* for_lp,
   this->setLpAndScalePointers(for_lp);
   if (factor_a_matrix) factor_.setupMatrix(factor_a_matrix);
   if (basic_index) basic_index_ = basic_index;
-  if (options) options_ = options;
+  if (options) {
+    options_ = options;
+    factor_.setUseLevelSchedule(options_->simplex_parallel_solve);
+    factor_.setUseParallelKernel(options_->simplex_parallel_factor);
+    factor_.setUseDenseKernel(options_->factor_dense_kernel);
+  }
   if (timer) timer_ = timer;
   if (analysis) analysis_ = analysis;
 }
@@ -336,8 +344,10 @@ void HSimplexNla::addCols(const HighsLp* updated_lp) {
   // Set the pointers for the LP and scaling. The pointer to the
   // vector of basic variables isn't updated, since it hasn't been
   // resized. The HFactor matrix isn't needed until reinversion has to
-  // be performed
+  // be performed, but HFactor must know the number of columns so
+  // that it can identify basic logicals
   setLpAndScalePointers(updated_lp);
+  factor_.addCols(updated_lp->num_col_ - factor_.num_col);
 }
 
 void HSimplexNla::addRows(const HighsLp* updated_lp, HighsInt* basic_index,
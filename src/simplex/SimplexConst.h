@@ -176,7 +176,9 @@ enum class LpAction {
   kNewBounds,
   kNewBasis,
   kNewCols,
+  kNewNonbasicCols,
   kNewRows,
+  kNewBasicRows,
   kDelCols,
   kDelNonbasicCols,
   kDelRows,
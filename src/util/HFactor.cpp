@@ -243,6 +243,13 @@ void HFactor::setupGeneral(
   use_original_HFactor_logic = use_original_HFactor_logic_;
   update_method = update_method_;
 
+  allocate();
+}
+
+void HFactor::allocate() {
+  // Allocate the arrays for INVERT and its updates. Called from
+  // setupGeneral, and from build if rows have been added since then
+  allocated_num_row_ = num_row;
   // Allocate for working buffer
   iwork.reserve(num_row * 2);
   dwork.assign(num_row, 0);
@@ -366,6 +373,8 @@ HighsInt HFactor::build(HighsTimerClock* factor_timer_clock_pointer) {
   const bool report_lu = false;
   // Ensure that the A matrix is valid for factorization
   assert(this->a_matrix_valid);
+  // Rows may have been added since the arrays were allocated
+  if (allocated_num_row_ != num_row) allocate();
   FactorTimer factor_timer;
   // Possibly use the refactorization information!
   if (refactor_info_.use) {
@@ -885,6 +894,7 @@ HighsInt HFactor::buildKernel() {
   double average_iteration_time = 0;
   const bool check_for_timeout = this->time_limit_ < kHighsInf;
   HighsInt search_k = 0;
+  bool singular_pivot_deferred = false;
 
   const HighsInt check_nwork = -11;
   while (nwork-- > 0) {
@@ -911,6 +921,15 @@ HighsInt HFactor::buildKernel() {
         return kBuildKernelReturnTimeout;
     }
 
+    // Factor the remaining kernel as a dense matrix if it has
+    // filled in, unless a column has been zeroed
+    if (!singular_pivot_deferred && useDenseKernel(nwork + 1)) {
+      build_synthetic_tick +=
+          fake_search * 20 + fake_fill * 160 + fake_eliminate * 80;
+      rank_deficiency = buildKernelDense(nwork + 1);
+      return rank_deficiency;
+    }
+
     /**
      * 1. Search for the pivot
      */
@@ -1096,6 +1115,7 @@ HighsInt HFactor::buildKernel() {
       }
       // No pivot found, so have to increment nwork
       nwork++;
+      singular_pivot_deferred = true;
       continue;
     }
     permute[jColPivot] = iRowPivot;
@@ -1138,103 +1158,85 @@ HighsInt HFactor::buildKernel() {
     // 2.4. Loop over pivot row to eliminate other column
     const HighsInt row_start = mr_start[iRowPivot];
     const HighsInt row_end = row_start + mr_count[iRowPivot];
-    for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
-      // 2.4.1. My pointer
-      HighsInt iCol = mr_index[row_k];
-      const HighsInt my_count = mc_count_a[iCol];
-      const HighsInt my_start = mc_start[iCol];
-      const HighsInt my_end = my_start + my_count - 1;
-      double my_pivot = colDelete(iCol, iRowPivot);
-      colStoreN(iCol, iRowPivot, my_pivot);
-
-      // 2.4.2. Elimination on the overlapping part
-      HighsInt nFillin = mwz_column_count;
-      HighsInt nCancel = 0;
-      for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-        HighsInt iRow = mc_index[my_k];
-        double value = mc_value[my_k];
-        if (mwz_column_mark[iRow]) {
-          mwz_column_mark[iRow] = 0;
-          nFillin--;
-          value -= my_pivot * mwz_column_array[iRow];
-          if (fabs(value) < kHighsTiny) {
-            value = 0;
-            nCancel++;
+    if (useParallelKernel(row_end - row_start, mwz_column_count)) {
+      buildKernelEliminate(iRowPivot, mwz_column_count, fake_eliminate);
+    } else {
+      for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
+        // 2.4.1. My pointer
+        HighsInt iCol = mr_index[row_k];
+        const HighsInt my_count = mc_count_a[iCol];
+        const HighsInt my_start = mc_start[iCol];
+        const HighsInt my_end = my_start + my_count - 1;
+        double my_pivot = colDelete(iCol, iRowPivot);
+        colStoreN(iCol, iRowPivot, my_pivot);
+
+        // 2.4.2. Elimination on the overlapping part
+        HighsInt nFillin = mwz_column_count;
+        HighsInt nCancel = 0;
+        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+          HighsInt iRow = mc_index[my_k];
+          double value = mc_value[my_k];
+          if (mwz_column_mark[iRow]) {
+            mwz_column_mark[iRow] = 0;
+            nFillin--;
+            value -= my_pivot * mwz_column_array[iRow];
+            if (fabs(value) < kHighsTiny) {
+              value = 0;
+              nCancel++;
+            }
+            mc_value[my_k] = value;
           }
-          mc_value[my_k] = value;
         }
-      }
-      fake_eliminate += mwz_column_count;
-      fake_eliminate += nFillin * 2;
-
-      // 2.4.3. Remove cancellation gaps
-      if (nCancel > 0) {
-        HighsInt new_end = my_start;
-        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-          if (mc_value[my_k] != 0) {
-            mc_index[new_end] = mc_index[my_k];
-            mc_value[new_end++] = mc_value[my_k];
-          } else {
-            rowDelete(iCol, mc_index[my_k]);
+        fake_eliminate += mwz_column_count;
+        fake_eliminate += nFillin * 2;
+
+        // 2.4.3. Remove cancellation gaps
+        if (nCancel > 0) {
+          HighsInt new_end = my_start;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            if (mc_value[my_k] != 0) {
+              mc_index[new_end] = mc_index[my_k];
+              mc_value[new_end++] = mc_value[my_k];
+            } else {
+              rowDelete(iCol, mc_index[my_k]);
+            }
           }
+          mc_count_a[iCol] = new_end - my_start;
         }
-        mc_count_a[iCol] = new_end - my_start;
-      }
 
-      // 2.4.4. Insert fill-in
-      if (nFillin > 0) {
-        // 2.4.4.1 Check column size
-        if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
-          // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
-          HighsInt p1 = mc_start[iCol];
-          HighsInt p2 = p1 + mc_count_a[iCol];
-          HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
-          HighsInt p4 = p1 + mc_space[iCol];
-          mc_space[iCol] += max(mc_space[iCol], nFillin);
-          HighsInt p5 = mc_start[iCol] = mc_index.size();
-          HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
-          mc_index.resize(p5 + mc_space[iCol]);
-          mc_value.resize(p5 + mc_space[iCol]);
-          copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
-          copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
-          copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
-          copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
-        }
+        // 2.4.4. Insert fill-in
+        if (nFillin > 0) {
+          // 2.4.4.1 Check column size
+          colMakeSpace(iCol, nFillin);
 
-        // 2.4.4.2 Fill into column copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow])
-            colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
-        }
+          // 2.4.4.2 Fill into column copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow])
+              colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
+          }
 
-        // 2.4.4.3 Fill into the row copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow]) {
-            // Expand row space
-            if (mr_count[iRow] == mr_space[iRow]) {
-              HighsInt p1 = mr_start[iRow];
-              HighsInt p2 = p1 + mr_count[iRow];
-              HighsInt p3 = mr_start[iRow] = mr_index.size();
-              mr_space[iRow] *= 2;
-              mr_index.resize(p3 + mr_space[iRow]);
-              copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+          // 2.4.4.3 Fill into the row copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow]) {
+              // Expand row space
+              rowMakeSpace(iRow);
+              rowInsert(iCol, iRow);
             }
-            rowInsert(iCol, iRow);
           }
         }
-      }
 
-      // 2.4.5. Reset pivot column mark
-      for (HighsInt i = 0; i < mwz_column_count; i++)
-        mwz_column_mark[mwz_column_index[i]] = 1;
+        // 2.4.5. Reset pivot column mark
+        for (HighsInt i = 0; i < mwz_column_count; i++)
+          mwz_column_mark[mwz_column_index[i]] = 1;
 
-      // 2.4.6. Fix max value and link list
-      colFixMax(iCol);
-      if (my_count != mc_count_a[iCol]) {
-        clinkDel(iCol);
-        clinkAdd(iCol, mc_count_a[iCol]);
+        // 2.4.6. Fix max value and link list
+        colFixMax(iCol);
+        if (my_count != mc_count_a[iCol]) {
+          clinkDel(iCol);
+          clinkAdd(iCol, mc_count_a[iCol]);
+        }
       }
     }
 
@@ -1483,6 +1485,9 @@ void HFactor::buildFinish() {
   pf_index.clear();
   pf_value.clear();
 
+  // Level schedules for parallel solves with dense RHS
+  buildLevelSchedules();
+
   if (!this->refactor_info_.use) {
     // Finally, if not calling buildFinish after refactorizing,
     // permute the basic variables
@@ -1542,7 +1547,11 @@ void HFactor::ftranL(HVector& rhs, const double expected_density,
   double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperFtranL;
-  if (sparse_solve) {
+  if (useLevelSchedule(ftran_l_schedule_, current_density, expected_density)) {
+    factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
+    solveLevelSchedule(ftran_l_schedule_, &l_pivot_index[0], NULL, true, rhs);
+    factor_timer.stop(FactorFtranLowerSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt* rhs_index = &rhs.index[0];
@@ -1592,7 +1601,11 @@ void HFactor::btranL(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperBtranL;
-  if (sparse_solve) {
+  if (useLevelSchedule(btran_l_schedule_, current_density, expected_density)) {
+    factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
+    solveLevelSchedule(btran_l_schedule_, &l_pivot_index[0], NULL, false, rhs);
+    factor_timer.stop(FactorBtranLowerSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt* rhs_index = &rhs.index[0];
@@ -1671,7 +1684,12 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperFtranU;
-  if (sparse_solve) {
+  if (useLevelSchedule(ftran_u_schedule_, current_density, expected_density)) {
+    factor_timer.start(FactorFtranUpperSps0, factor_timer_clock_pointer);
+    solveLevelSchedule(ftran_u_schedule_, &u_pivot_index[0], &u_pivot_value[0],
+                       false, rhs);
+    factor_timer.stop(FactorFtranUpperSps0, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     const bool report_ftran_upper_sparse =
         false;  // current_density < kHyperCancel;
     HighsInt use_clock;
@@ -1780,7 +1798,12 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperBtranU;
-  if (sparse_solve) {
+  if (useLevelSchedule(btran_u_schedule_, current_density, expected_density)) {
+    factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
+    solveLevelSchedule(btran_u_schedule_, &u_pivot_index[0], &u_pivot_value[0],
+                       true, rhs);
+    factor_timer.stop(FactorBtranUpperSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
     // Alias to non constant
     double rhs_synthetic_tick = 0;
@@ -2582,6 +2605,7 @@ void HFactor::setInvert(const InvertibleRepresentation& invert) {
   this->pf_value = invert.pf_value;
   this->pf_pivot_index = invert.pf_pivot_index;
   this->pf_pivot_value = invert.pf_pivot_value;
+  buildLevelSchedules();
 }
 
 void InvertibleRepresentation::clear() {
@@ -69,6 +69,28 @@ struct InvertibleRepresentation {
   void clear();
 };
 
+/**
+ * @brief Level schedule for a triangular solve with L or U
+ *
+ * The solve is held row by row: the value for pivot i is updated by
+ * the values of the entries [start[i], start[i+1]), in the order that
+ * the serial column-oriented solve would update it, so the result is
+ * the same. Pivots in one level only depend on pivots in earlier
+ * levels, so the pivots level_pivot[level_start[l]..level_start[l+1])
+ * can be solved in parallel. Levels with little work are solved
+ * serially, as indicated by level_parallel
+ */
+struct HFactorLevelSchedule {
+  std::vector<HighsInt> level_start;
+  std::vector<HighsInt> level_pivot;
+  std::vector<bool> level_parallel;
+  std::vector<HighsInt> start;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  bool valid() const { return !level_start.empty(); }
+  void clear();
+};
+
 /**
  * @brief Basis matrix factorization, update and solves for HiGHS
  *
@@ -220,6 +242,24 @@ class HFactor {
    */
   void setTimeLimit(const double time_limit);
 
+  /**
+   * @brief Sets whether INVERT forms level schedules so that solves
+   * with dense RHS run in parallel
+   */
+  void setUseLevelSchedule(const bool use_level_schedule);
+
+  /**
+   * @brief Sets whether INVERT eliminates the pivot row of large
+   * kernel pivots in parallel
+   */
+  void setUseParallelKernel(const bool use_parallel_kernel);
+
+  /**
+   * @brief Sets whether INVERT switches to a dense LU factorization
+   * when the remaining kernel is dense
+   */
+  void setUseDenseKernel(const bool use_dense_kernel);
+
   /**
    * @brief Updates instance with respect to new columns in the
    * constraint matrix (assuming columns are nonbasic)
@@ -430,10 +470,35 @@ class HFactor {
 
   HVector rhs_;
 
+  // Level schedules for parallel solves with dense RHS
+  bool use_level_schedule_ = false;
+  HFactorLevelSchedule ftran_l_schedule_;
+  HFactorLevelSchedule btran_l_schedule_;
+  HFactorLevelSchedule ftran_u_schedule_;
+  HFactorLevelSchedule btran_u_schedule_;
+
+  // Parallel elimination of large kernel pivots
+  bool use_parallel_kernel_ = false;
+  vector<vector<char>> kernel_thread_mark_;
+
+  // Dense LU factorization of the remaining kernel
+  bool use_dense_kernel_ = false;
+
+  // Number of rows for which the arrays were allocated
+  HighsInt allocated_num_row_ = 0;
+
   // Implementation
+  void allocate();
   void buildSimple();
   //    void buildKernel();
   HighsInt buildKernel();
+  bool useParallelKernel(const HighsInt row_count,
+                         const HighsInt column_count) const;
+  void buildKernelEliminate(const HighsInt iRowPivot,
+                            const HighsInt mwz_column_count,
+                            double& fake_eliminate);
+  bool useDenseKernel(const HighsInt dense_dim) const;
+  HighsInt buildKernelDense(const HighsInt dense_dim);
   void buildHandleRankDeficiency();
   void buildReportRankDeficiency();
   void buildMarkSingC();
@@ -460,6 +525,20 @@ class HFactor {
   void btranU(HVector& vector, const double expected_density,
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
 
+  void buildLevelSchedules();
+  void buildLevelSchedule(const HighsInt* pivot_index,
+                          const HighsInt* pivot_lookup,
+                          const HighsInt* push_start, const HighsInt* push_end,
+                          const HighsInt* push_index, const double* push_value,
+                          const bool forward, HFactorLevelSchedule& schedule);
+  bool useLevelSchedule(const HFactorLevelSchedule& schedule,
+                        const double current_density,
+                        const double expected_density) const;
+  void solveLevelSchedule(const HFactorLevelSchedule& schedule,
+                          const HighsInt* pivot_index,
+                          const double* pivot_value, const bool forward,
+                          HVector& rhs) const;
+
   void ftranFT(HVector& vector) const;
   void btranFT(HVector& vector) const;
   void ftranPF(HVector& vector) const;
@@ -489,6 +568,24 @@ class HFactor {
     mc_index[iput] = iRow;
     mc_value[iput] = value;
   }
+  void colMakeSpace(const HighsInt iCol, const HighsInt nFillin) {
+    if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
+      // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
+      HighsInt p1 = mc_start[iCol];
+      HighsInt p2 = p1 + mc_count_a[iCol];
+      HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
+      HighsInt p4 = p1 + mc_space[iCol];
+      mc_space[iCol] += max(mc_space[iCol], nFillin);
+      HighsInt p5 = mc_start[iCol] = mc_index.size();
+      HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
+      mc_index.resize(p5 + mc_space[iCol]);
+      mc_value.resize(p5 + mc_space[iCol]);
+      std::copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
+      std::copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
+      std::copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
+      std::copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
+    }
+  }
   void colFixMax(const HighsInt iCol) {
     double max_value = 0;
     for (HighsInt k = mc_start[iCol]; k < mc_start[iCol] + mc_count_a[iCol];
@@ -512,6 +609,17 @@ class HFactor {
     mr_index[iput] = iCol;
   }
 
+  void rowMakeSpace(const HighsInt iRow) {
+    if (mr_count[iRow] == mr_space[iRow]) {
+      HighsInt p1 = mr_start[iRow];
+      HighsInt p2 = p1 + mr_count[iRow];
+      HighsInt p3 = mr_start[iRow] = mr_index.size();
+      mr_space[iRow] *= 2;
+      mr_index.resize(p3 + mr_space[iRow]);
+      std::copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+    }
+  }
+
   void rowDelete(const HighsInt iCol, const HighsInt iRow) {
     HighsInt idel = mr_start[iRow];
     HighsInt imov = idel + (--mr_count[iRow]);
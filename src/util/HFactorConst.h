@@ -55,6 +55,39 @@ const double kHyperCancel = 0.05;
  */
 const double kHyperResult = 0.10;
 
+/**
+ * Thresholds for using level scheduled parallel TRANs: the RHS or
+ * result density, the average number of pivots in a level, and the
+ * number of pivots and entries in a level for it to be split into
+ * tasks of kLevelScheduleGrainSize pivots
+ */
+const double kLevelScheduleDensity = 0.3;
+const HighsInt kLevelScheduleMinAverageWidth = 64;
+const HighsInt kLevelScheduleMinWork = 8192;
+const HighsInt kLevelScheduleGrainSize = 256;
+
+/**
+ * Thresholds for eliminating the pivot row of a kernel pivot in
+ * parallel: the number of columns in the pivot row times the number
+ * of rows in the pivot column, the number of columns in a task, and
+ * the number of fill-in rows recorded before the row-wise copy is
+ * updated
+ */
+const HighsInt kParallelKernelMinWork = 16384;
+const HighsInt kParallelKernelGrainSize = 16;
+const HighsInt kParallelKernelMaxFillBuffer = 1 << 20;
+
+/**
+ * Thresholds for factoring the remaining kernel as a dense matrix:
+ * its minimum and maximum dimension, and the minimum count of its
+ * columns and rows relative to its dimension. The dense LU works on
+ * panels of kDenseKernelPanelSize columns
+ */
+const HighsInt kDenseKernelMinDim = 64;
+const HighsInt kDenseKernelMaxDim = 2500;
+const double kDenseKernelDensity = 0.4;
+const HighsInt kDenseKernelPanelSize = 32;
+
 /**
  * Parameters for reinversion on synthetic clock
  */
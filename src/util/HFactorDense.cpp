@@ -0,0 +1,173 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HFactorDense.cpp
+ * @brief Dense LU factorization of the remaining kernel
+ */
+#include "parallel/HighsParallel.h"
+#include "util/HFactor.h"
+
+// Subtracts the multiples col_j[k] of the columns k in [from_k, to_k)
+// of L from the rows below k of col_j. The inner loop is over
+// contiguous entries, so the compiler vectorises it
+static void denseUpdateColumn(const HighsInt dim, const double* dense,
+                              const HighsInt from_k, const HighsInt to_k,
+                              double* col_j) {
+  for (HighsInt k = from_k; k < to_k; k++) {
+    const double multiplier = col_j[k];
+    if (multiplier == 0) continue;
+    const double* col_k = dense + (size_t)k * dim;
+    for (HighsInt i = k + 1; i < dim; i++) col_j[i] -= col_k[i] * multiplier;
+  }
+}
+
+void HFactor::setUseDenseKernel(const bool use_dense_kernel) {
+  use_dense_kernel_ = use_dense_kernel;
+}
+
+bool HFactor::useDenseKernel(const HighsInt dense_dim) const {
+  if (!use_dense_kernel_ || num_basic != num_row) return false;
+  if (dense_dim < kDenseKernelMinDim || dense_dim > kDenseKernelMaxDim)
+    return false;
+  const HighsInt min_count = (HighsInt)(kDenseKernelDensity * dense_dim);
+  for (HighsInt count = 0; count < min_count; count++) {
+    if (col_link_first[count] >= 0) return false;
+    if (row_link_first[count] >= 0) return false;
+  }
+  return true;
+}
+
+HighsInt HFactor::buildKernelDense(const HighsInt dense_dim) {
+  // Gather the remaining kernel into a column-major dense matrix,
+  // with its columns in increasing order of count
+  vector<HighsInt> dense_col;
+  vector<HighsInt> dense_row;
+  for (HighsInt count = 0; count <= num_row; count++)
+    for (HighsInt j = col_link_first[count]; j != -1; j = col_link_next[j])
+      dense_col.push_back(j);
+  for (HighsInt count = 0; count <= num_basic; count++)
+    for (HighsInt i = row_link_first[count]; i != -1; i = row_link_next[i])
+      dense_row.push_back(i);
+  assert((HighsInt)dense_col.size() == dense_dim);
+  assert((HighsInt)dense_row.size() == dense_dim);
+  const HighsInt dim = dense_dim;
+  vector<HighsInt> row_position(num_row, -1);
+  for (HighsInt i = 0; i < dim; i++) row_position[dense_row[i]] = i;
+  vector<double> dense((size_t)dim * dim, 0);
+  for (HighsInt k = 0; k < dim; k++) {
+    const HighsInt jCol = dense_col[k];
+    double* col_k = &dense[(size_t)k * dim];
+    for (HighsInt el = mc_start[jCol]; el < mc_start[jCol] + mc_count_a[jCol];
+         el++)
+      col_k[row_position[mc_index[el]]] = mc_value[el];
+  }
+
+  // Right-looking LU with partial pivoting, by panels of columns. The
+  // pivots of a panel are applied to each column to its right while
+  // the panel is in cache. Singular columns are moved to the end
+  const bool parallel_update =
+      use_parallel_kernel_ && highs::parallel::num_threads() > 1;
+  HighsInt num_pivot = dim;
+  for (HighsInt from_k = 0; from_k < num_pivot;
+       from_k += kDenseKernelPanelSize) {
+    HighsInt to_k = std::min(from_k + kDenseKernelPanelSize, num_pivot);
+    for (HighsInt k = from_k; k < to_k;) {
+      double* col_k = &dense[(size_t)k * dim];
+      HighsInt pivot_position = k;
+      double max_value = fabs(col_k[k]);
+      for (HighsInt i = k + 1; i < dim; i++) {
+        if (fabs(col_k[i]) > max_value) {
+          max_value = fabs(col_k[i]);
+          pivot_position = i;
+        }
+      }
+      if (max_value < pivot_tolerance) {
+        // Swap the singular column with the last candidate column,
+        // bringing that up to date with the pivots of this panel
+        num_pivot--;
+        if (k < num_pivot) {
+          double* col_last = &dense[(size_t)num_pivot * dim];
+          std::swap_ranges(col_k, col_k + dim, col_last);
+          std::swap(dense_col[k], dense_col[num_pivot]);
+          if (num_pivot >= to_k)
+            denseUpdateColumn(dim, dense.data(), from_k, k, col_k);
+        }
+        to_k = std::min(to_k, num_pivot);
+        continue;
+      }
+      if (pivot_position != k) {
+        for (HighsInt j = 0; j < dim; j++)
+          std::swap(dense[(size_t)j * dim + k],
+                    dense[(size_t)j * dim + pivot_position]);
+        std::swap(dense_row[k], dense_row[pivot_position]);
+      }
+      const double pivot = col_k[k];
+      for (HighsInt i = k + 1; i < dim; i++) col_k[i] /= pivot;
+      for (HighsInt j = k + 1; j < to_k; j++)
+        denseUpdateColumn(dim, dense.data(), k, k + 1,
+                          &dense[(size_t)j * dim]);
+      k++;
+    }
+    auto updateColumns = [&](HighsInt from_j, HighsInt to_j) {
+      for (HighsInt j = from_j; j < to_j; j++)
+        denseUpdateColumn(dim, dense.data(), from_k, to_k,
+                          &dense[(size_t)j * dim]);
+    };
+    if (parallel_update)
+      highs::parallel::for_each(to_k, num_pivot, updateColumns,
+                                kDenseKernelPanelSize);
+    else
+      updateColumns(to_k, num_pivot);
+  }
+  build_synthetic_tick += (double)num_pivot * dim * dim / 3 * 80;
+
+  // Store the factors as for Markowitz pivots
+  for (HighsInt k = 0; k < num_pivot; k++) {
+    const HighsInt jColPivot = dense_col[k];
+    const HighsInt iRowPivot = dense_row[k];
+    const double* col_k = &dense[(size_t)k * dim];
+    permute[jColPivot] = iRowPivot;
+    this->refactor_info_.pivot_row.push_back(iRowPivot);
+    this->refactor_info_.pivot_var.push_back(basic_index[jColPivot]);
+    this->refactor_info_.pivot_type.push_back(kPivotMarkowitz);
+
+    for (HighsInt i = k + 1; i < dim; i++) {
+      if (fabs(col_k[i]) < kHighsTiny) continue;
+      l_index.push_back(dense_row[i]);
+      l_value.push_back(col_k[i]);
+    }
+    l_start.push_back(l_index.size());
+
+    // Entries of U from the sparse elimination, and then those from
+    // the dense elimination
+    const HighsInt end_N = mc_start[jColPivot] + mc_space[jColPivot];
+    for (HighsInt el = end_N - mc_count_n[jColPivot]; el < end_N; el++) {
+      u_index.push_back(mc_index[el]);
+      u_value.push_back(mc_value[el]);
+    }
+    for (HighsInt i = 0; i < k; i++) {
+      if (fabs(col_k[i]) < kHighsTiny) continue;
+      u_index.push_back(dense_row[i]);
+      u_value.push_back(col_k[i]);
+    }
+    u_pivot_index.push_back(iRowPivot);
+    u_pivot_value.push_back(col_k[k]);
+    u_start.push_back(u_index.size());
+  }
+  const HighsInt dense_rank_deficiency = dim - num_pivot;
+  if (dense_rank_deficiency)
+    highsLogDev(log_options, HighsLogType::kWarning,
+                "Factorization identifies rank deficiency of %" HIGHSINT_FORMAT
+                "\n",
+                dense_rank_deficiency);
+  return dense_rank_deficiency;
+}
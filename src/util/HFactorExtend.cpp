@@ -32,13 +32,12 @@ void HFactor::deleteNonbasicCols(const HighsInt num_deleted_col) {
 
 void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   invalidAMatrixAction();
-  assert(kExtendInvertWhenAddingRows);
+  // The basis matrix must be square, and the slacks of the new rows
+  // basic, so the factors are extended by the new rows of L and unit
+  // pivots in U
+  assert(num_basic == num_row);
   HighsInt num_new_row = ar_matrix->num_row_;
   HighsInt new_num_row = num_row + num_new_row;
-  printf("Adding %" HIGHSINT_FORMAT
-         " new rows to HFactor instance: increasing dimension from "
-         "%" HIGHSINT_FORMAT " to %" HIGHSINT_FORMAT " \n",
-         num_new_row, num_row, new_num_row);
 
   // Need to know where (if) a column is basic
   vector<HighsInt> in_basis;
@@ -131,14 +130,17 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
     l_start[iCol] = l_matrix_new_num_nz;
   //
   // Insert the new entries, remembering to offset the index values by
-  // num_row, since new_lr_cols only has the new rows
+  // num_row, since new_lr_cols only has the new rows. The columns of L
+  // are stored in pivot order, whereas those of new_lr_cols are
+  // indexed by pivot row
   l_index.resize(l_matrix_new_num_nz);
   l_value.resize(l_matrix_new_num_nz);
   for (HighsInt iCol = num_row - 1; iCol >= 0; iCol--) {
     const HighsInt from_el = l_start[iCol + 1];
+    const HighsInt pivot_row = l_pivot_index[iCol];
     l_start[iCol + 1] = to_el;
-    for (HighsInt iEl = new_lr_cols.start_[iCol + 1] - 1;
-         iEl >= new_lr_cols.start_[iCol]; iEl--) {
+    for (HighsInt iEl = new_lr_cols.start_[pivot_row + 1] - 1;
+         iEl >= new_lr_cols.start_[pivot_row]; iEl--) {
       to_el--;
       l_index[to_el] = num_row + new_lr_cols.index_[iEl];
       l_value[to_el] = new_lr_cols.value_[iEl];
@@ -188,8 +190,6 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   // Need to refer to just the new UR vectors
   HighsInt ur_cur_num_vec = ur_start.size();
   HighsInt ur_new_num_vec = ur_cur_num_vec + num_new_row;
-  printf("\nUpdating UR vectors %d - %d\n", (int)ur_cur_num_vec,
-         (int)ur_new_num_vec - 1);
   // UR pointer
   //
   // Allow space to the start of new rows, including the start for the
@@ -216,10 +216,7 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
     HighsInt gap = ur_temp[iRow - 1] + ur_stuff_size;
     ur_start[iRow] = iStart + gap;
     iStart += gap;
-    printf("ur_start[%d] = %d; gap = %d; iStart = %d\n", (int)iRow,
-           (int)ur_start[iRow], (int)gap, (int)iStart);
   }
-  printf("ur_count_size = %d; iStart%d\n", (int)ur_count_size, (int)iStart);
   // Lose the start for the fictitious ur_new_num_vec'th row
   ur_start.resize(ur_new_num_vec);
   // Resize ur_lastp and initialise its new entries to be the ur_start
@@ -228,7 +225,19 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   for (HighsInt iRow = ur_cur_num_vec; iRow < ur_new_num_vec; iRow++)
     ur_lastp[iRow] = ur_start[iRow];
   //
-  // Increase the number of rows in HFactor
+  // Increase the number of rows in HFactor. The arrays for INVERT
+  // are allocated for the new dimension by the next build, but those
+  // used by solves and updates are needed now
   num_row += num_new_row;
+  num_basic += num_new_row;
+  dwork.assign(num_row, 0);
+  rhs_.setup(num_row);
+  rhs_.count = -1;
   //  reportLu(kReportLuBoth, true);
+  //
+  // The level schedules are formed again by the next INVERT
+  ftran_l_schedule_.clear();
+  btran_l_schedule_.clear();
+  ftran_u_schedule_.clear();
+  btran_u_schedule_.clear();
 }
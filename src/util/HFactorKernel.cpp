@@ -0,0 +1,172 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HFactorKernel.cpp
+ * @brief Parallel elimination of large kernel pivots
+ */
+#include "parallel/HighsParallel.h"
+#include "util/HFactor.h"
+
+void HFactor::setUseParallelKernel(const bool use_parallel_kernel) {
+  use_parallel_kernel_ = use_parallel_kernel;
+  if (!use_parallel_kernel_) kernel_thread_mark_.clear();
+}
+
+bool HFactor::useParallelKernel(const HighsInt row_count,
+                                const HighsInt column_count) const {
+  if (!use_parallel_kernel_) return false;
+  if (row_count < 2 * kParallelKernelGrainSize) return false;
+  if ((double)row_count * column_count < kParallelKernelMinWork) return false;
+  return highs::parallel::num_threads() > 1;
+}
+
+void HFactor::buildKernelEliminate(const HighsInt iRowPivot,
+                                   const HighsInt mwz_column_count,
+                                   double& fake_eliminate) {
+  // The columns of the pivot row are eliminated in chunks. Within a
+  // chunk, the numerical elimination of each column is independent of
+  // the other columns, so it is performed in parallel, recording the
+  // rows where there is cancellation or fill-in. The changes to the
+  // row-wise copy, the space of the columns and the count link lists
+  // are then made serially, in the order of the pivot row, so the
+  // factors are identical to those of the serial elimination.
+  const HighsInt num_threads = highs::parallel::num_threads();
+  if ((HighsInt)kernel_thread_mark_.size() < num_threads)
+    kernel_thread_mark_.resize(num_threads);
+  for (vector<char>& mark : kernel_thread_mark_)
+    if ((HighsInt)mark.size() < num_row) mark.assign(num_row, 0);
+
+  // Cap the fill-in buffer of a chunk
+  const HighsInt max_chunk_count = max(
+      (HighsInt)kParallelKernelGrainSize * num_threads,
+      (HighsInt)(kParallelKernelMaxFillBuffer / max(mwz_column_count, 1)));
+
+  const HighsInt row_start = mr_start[iRowPivot];
+  const HighsInt row_count = mr_count[iRowPivot];
+  vector<HighsInt> my_count;
+  vector<double> my_pivot;
+  vector<HighsInt> cancel_start;
+  vector<HighsInt> cancel_count;
+  vector<HighsInt> cancel_index;
+  vector<HighsInt> fill_count;
+  vector<HighsInt> fill_index;
+  for (HighsInt chunk_start = 0; chunk_start < row_count;
+       chunk_start += max_chunk_count) {
+    const HighsInt chunk_count =
+        std::min(max_chunk_count, row_count - chunk_start);
+    // The space of the pivot row does not move, but mr_index may be
+    // reallocated when fill-in is inserted into the row-wise copy
+    const HighsInt chunk_el = row_start + chunk_start;
+    my_count.resize(chunk_count);
+    my_pivot.resize(chunk_count);
+    cancel_start.resize(chunk_count + 1);
+    cancel_count.resize(chunk_count);
+    fill_count.resize(chunk_count);
+    cancel_start[0] = 0;
+    for (HighsInt i = 0; i < chunk_count; i++)
+      cancel_start[i + 1] =
+          cancel_start[i] + mc_count_a[mr_index[chunk_el + i]];
+    cancel_index.resize(cancel_start[chunk_count]);
+    fill_index.resize((size_t)chunk_count * mwz_column_count);
+
+    // Numerical elimination, changing only the space of each column
+    highs::parallel::for_each(
+        0, chunk_count,
+        [&](HighsInt from, HighsInt to) {
+          vector<char>& mark =
+              kernel_thread_mark_[highs::parallel::thread_num()];
+          for (HighsInt i = from; i < to; i++) {
+            const HighsInt iCol = mr_index[chunk_el + i];
+            const HighsInt col_count = mc_count_a[iCol];
+            const HighsInt col_start = mc_start[iCol];
+            const HighsInt col_end = col_start + col_count - 1;
+            const double col_pivot = colDelete(iCol, iRowPivot);
+            colStoreN(iCol, iRowPivot, col_pivot);
+            my_count[i] = col_count;
+            my_pivot[i] = col_pivot;
+
+            // Elimination on the overlapping part
+            HighsInt nCancel = 0;
+            for (HighsInt my_k = col_start; my_k < col_end; my_k++) {
+              HighsInt iRow = mc_index[my_k];
+              if (mwz_column_mark[iRow]) {
+                mark[iRow] = 1;
+                double value =
+                    mc_value[my_k] - col_pivot * mwz_column_array[iRow];
+                if (fabs(value) < kHighsTiny) {
+                  value = 0;
+                  nCancel++;
+                }
+                mc_value[my_k] = value;
+              }
+            }
+
+            // Remove cancellation gaps
+            HighsInt* cancel = &cancel_index[cancel_start[i]];
+            cancel_count[i] = 0;
+            if (nCancel > 0) {
+              HighsInt new_end = col_start;
+              for (HighsInt my_k = col_start; my_k < col_end; my_k++) {
+                if (mc_value[my_k] != 0) {
+                  mc_index[new_end] = mc_index[my_k];
+                  mc_value[new_end++] = mc_value[my_k];
+                } else {
+                  cancel[cancel_count[i]++] = mc_index[my_k];
+                }
+              }
+              mc_count_a[iCol] = new_end - col_start;
+            }
+
+            // Rows of the pivot column that are not in this column
+            HighsInt* fill = &fill_index[(size_t)i * mwz_column_count];
+            fill_count[i] = 0;
+            for (HighsInt k = 0; k < mwz_column_count; k++) {
+              HighsInt iRow = mwz_column_index[k];
+              if (mark[iRow])
+                mark[iRow] = 0;
+              else
+                fill[fill_count[i]++] = iRow;
+            }
+          }
+        },
+        kParallelKernelGrainSize);
+
+    // Structural changes in the order of the pivot row
+    for (HighsInt i = 0; i < chunk_count; i++) {
+      const HighsInt iCol = mr_index[chunk_el + i];
+      const HighsInt nFillin = fill_count[i];
+      fake_eliminate += mwz_column_count;
+      fake_eliminate += nFillin * 2;
+
+      const HighsInt* cancel = &cancel_index[cancel_start[i]];
+      for (HighsInt k = 0; k < cancel_count[i]; k++)
+        rowDelete(iCol, cancel[k]);
+
+      if (nFillin > 0) {
+        const HighsInt* fill = &fill_index[(size_t)i * mwz_column_count];
+        colMakeSpace(iCol, nFillin);
+        for (HighsInt k = 0; k < nFillin; k++)
+          colInsert(iCol, fill[k], -my_pivot[i] * mwz_column_array[fill[k]]);
+        for (HighsInt k = 0; k < nFillin; k++) {
+          rowMakeSpace(fill[k]);
+          rowInsert(iCol, fill[k]);
+        }
+      }
+
+      colFixMax(iCol);
+      if (my_count[i] != mc_count_a[iCol]) {
+        clinkDel(iCol);
+        clinkAdd(iCol, mc_count_a[iCol]);
+      }
+    }
+  }
+}
@@ -0,0 +1,186 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HFactorLevel.cpp
+ * @brief Level scheduled parallel triangular solves
+ */
+#include "parallel/HighsParallel.h"
+#include "util/HFactor.h"
+
+void HFactorLevelSchedule::clear() {
+  level_start.clear();
+  level_pivot.clear();
+  level_parallel.clear();
+  start.clear();
+  index.clear();
+  value.clear();
+}
+
+void HFactor::setUseLevelSchedule(const bool use_level_schedule) {
+  use_level_schedule_ = use_level_schedule;
+  if (!use_level_schedule_) buildLevelSchedules();
+}
+
+void HFactor::buildLevelSchedules() {
+  ftran_l_schedule_.clear();
+  btran_l_schedule_.clear();
+  ftran_u_schedule_.clear();
+  btran_u_schedule_.clear();
+  if (!use_level_schedule_ || highs::parallel::num_threads() <= 1) return;
+  // The serial solves with L run forwards through the columns of L
+  // (FTRAN) or backwards through its rows (BTRAN), and with U
+  // backwards through its columns (FTRAN) or forwards through its
+  // rows (BTRAN)
+  buildLevelSchedule(l_pivot_index.data(), l_pivot_lookup.data(),
+                     l_start.data(), l_start.data() + 1, l_index.data(),
+                     l_value.data(), true, ftran_l_schedule_);
+  buildLevelSchedule(l_pivot_index.data(), l_pivot_lookup.data(),
+                     lr_start.data(), lr_start.data() + 1, lr_index.data(),
+                     lr_value.data(), false, btran_l_schedule_);
+  buildLevelSchedule(u_pivot_index.data(), u_pivot_lookup.data(),
+                     u_start.data(), u_last_p.data(), u_index.data(),
+                     u_value.data(), false, ftran_u_schedule_);
+  buildLevelSchedule(u_pivot_index.data(), u_pivot_lookup.data(),
+                     ur_start.data(), ur_lastp.data(), ur_index.data(),
+                     ur_value.data(), true, btran_u_schedule_);
+}
+
+void HFactor::buildLevelSchedule(const HighsInt* pivot_index,
+                                 const HighsInt* pivot_lookup,
+                                 const HighsInt* push_start,
+                                 const HighsInt* push_end,
+                                 const HighsInt* push_index,
+                                 const double* push_value, const bool forward,
+                                 HFactorLevelSchedule& schedule) {
+  schedule.clear();
+  // Determine the level of each pivot, visiting the pivots in the
+  // order of the serial solve, where the entries of a pivot update
+  // later pivots
+  std::vector<HighsInt> level(num_row, 0);
+  HighsInt num_level = 0;
+  for (HighsInt step = 0; step < num_row; step++) {
+    const HighsInt iPivot = forward ? step : num_row - 1 - step;
+    const HighsInt next_level = level[iPivot] + 1;
+    num_level = std::max(next_level, num_level);
+    for (HighsInt k = push_start[iPivot]; k < push_end[iPivot]; k++) {
+      HighsInt jPivot = pivot_lookup[push_index[k]];
+      level[jPivot] = std::max(next_level, level[jPivot]);
+    }
+  }
+  // Not worth solving in parallel if the levels are narrow
+  if (num_row < num_level * kLevelScheduleMinAverageWidth) return;
+
+  // Order the pivots by level
+  schedule.level_start.assign(num_level + 1, 0);
+  for (HighsInt iPivot = 0; iPivot < num_row; iPivot++)
+    schedule.level_start[level[iPivot] + 1]++;
+  for (HighsInt iLevel = 0; iLevel < num_level; iLevel++)
+    schedule.level_start[iLevel + 1] += schedule.level_start[iLevel];
+  std::vector<HighsInt> put(schedule.level_start.begin(),
+                            schedule.level_start.end() - 1);
+  schedule.level_pivot.resize(num_row);
+  for (HighsInt step = 0; step < num_row; step++) {
+    const HighsInt iPivot = forward ? step : num_row - 1 - step;
+    schedule.level_pivot[put[level[iPivot]]++] = iPivot;
+  }
+
+  // Transpose the entries so that each pivot gathers its updates, in
+  // the order that the serial solve applies them
+  schedule.start.assign(num_row + 1, 0);
+  for (HighsInt iPivot = 0; iPivot < num_row; iPivot++)
+    for (HighsInt k = push_start[iPivot]; k < push_end[iPivot]; k++)
+      schedule.start[pivot_lookup[push_index[k]] + 1]++;
+  for (HighsInt iPivot = 0; iPivot < num_row; iPivot++)
+    schedule.start[iPivot + 1] += schedule.start[iPivot];
+  schedule.index.resize(schedule.start[num_row]);
+  schedule.value.resize(schedule.start[num_row]);
+  put.assign(schedule.start.begin(), schedule.start.end() - 1);
+  for (HighsInt step = 0; step < num_row; step++) {
+    const HighsInt iPivot = forward ? step : num_row - 1 - step;
+    for (HighsInt k = push_start[iPivot]; k < push_end[iPivot]; k++) {
+      const HighsInt iPut = put[pivot_lookup[push_index[k]]]++;
+      schedule.index[iPut] = pivot_index[iPivot];
+      schedule.value[iPut] = push_value[k];
+    }
+  }
+
+  // Only levels with enough work are worth splitting into tasks
+  schedule.level_parallel.assign(num_level, false);
+  for (HighsInt iLevel = 0; iLevel < num_level; iLevel++) {
+    HighsInt level_work = 0;
+    for (HighsInt iLevelPivot = schedule.level_start[iLevel];
+         iLevelPivot < schedule.level_start[iLevel + 1]; iLevelPivot++) {
+      const HighsInt iPivot = schedule.level_pivot[iLevelPivot];
+      level_work += 1 + schedule.start[iPivot + 1] - schedule.start[iPivot];
+    }
+    schedule.level_parallel[iLevel] = level_work >= kLevelScheduleMinWork;
+  }
+}
+
+bool HFactor::useLevelSchedule(const HFactorLevelSchedule& schedule,
+                               const double current_density,
+                               const double expected_density) const {
+  if (!schedule.valid()) return false;
+  // Only dense RHS or results benefit, since every pivot is visited
+  if (std::max(current_density, expected_density) < kLevelScheduleDensity)
+    return false;
+  // The schedules for U are only valid until the first update
+  if (&schedule == &ftran_u_schedule_ || &schedule == &btran_u_schedule_)
+    return u_pivot_index.size() == (size_t)num_row;
+  return true;
+}
+
+void HFactor::solveLevelSchedule(const HFactorLevelSchedule& schedule,
+                                 const HighsInt* pivot_index,
+                                 const double* pivot_value, const bool forward,
+                                 HVector& rhs) const {
+  double* rhs_array = rhs.array.data();
+  const HighsInt* start = schedule.start.data();
+  const HighsInt* index = schedule.index.data();
+  const double* value = schedule.value.data();
+  const HighsInt* level_pivot = schedule.level_pivot.data();
+
+  // Only the pivots of earlier levels are read, and each pivot is
+  // written by one task
+  auto solvePivots = [&](HighsInt from, HighsInt to) {
+    for (HighsInt iLevelPivot = from; iLevelPivot < to; iLevelPivot++) {
+      const HighsInt iPivot = level_pivot[iLevelPivot];
+      const HighsInt pivotRow = pivot_index[iPivot];
+      double pivot_multiplier = rhs_array[pivotRow];
+      for (HighsInt k = start[iPivot]; k < start[iPivot + 1]; k++)
+        pivot_multiplier -= rhs_array[index[k]] * value[k];
+      if (fabs(pivot_multiplier) > kHighsTiny) {
+        if (pivot_value) pivot_multiplier /= pivot_value[iPivot];
+        rhs_array[pivotRow] = pivot_multiplier;
+      } else
+        rhs_array[pivotRow] = 0;
+    }
+  };
+  const HighsInt num_level = schedule.level_start.size() - 1;
+  for (HighsInt iLevel = 0; iLevel < num_level; iLevel++) {
+    if (schedule.level_parallel[iLevel])
+      highs::parallel::for_each(schedule.level_start[iLevel],
+                                schedule.level_start[iLevel + 1], solvePivots,
+                                kLevelScheduleGrainSize);
+    else
+      solvePivots(schedule.level_start[iLevel],
+                  schedule.level_start[iLevel + 1]);
+  }
+
+  // Gather the nonzeros in the order of the serial solve
+  HighsInt rhs_count = 0;
+  for (HighsInt step = 0; step < num_row; step++) {
+    const HighsInt pivotRow = pivot_index[forward ? step : num_row - 1 - step];
+    if (rhs_array[pivotRow] != 0) rhs.index[rhs_count++] = pivotRow;
+  }
+  rhs.count = rhs_count;
+}
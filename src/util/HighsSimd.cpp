@@ -0,0 +1,417 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.cpp
+ * @brief
+ */
+#include "util/HighsSimd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include "HConfig.h"
+#include "lp_data/HConst.h"
+
+// The vector kernels gather with 32 bit indices
+#if defined(HIGHS_HAVE_SIMD_DISPATCH) && !defined(HIGHSINT64)
+#define HIGHS_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace highs {
+namespace simd {
+
+static Isa detectIsa() {
+#ifdef HIGHS_SIMD_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return Isa::kAvx512;
+  if (__builtin_cpu_supports("avx2")) return Isa::kAvx2;
+#endif
+  return Isa::kScalar;
+}
+
+Isa supportedIsa() {
+  static const Isa isa = detectIsa();
+  return isa;
+}
+
+static std::atomic<Isa>& currentIsa() {
+  static std::atomic<Isa> isa{supportedIsa()};
+  return isa;
+}
+
+Isa activeIsa() { return currentIsa().load(std::memory_order_relaxed); }
+
+void setActiveIsa(Isa isa) {
+  currentIsa().store(std::min(isa, supportedIsa()), std::memory_order_relaxed);
+}
+
+static void priceColumnsScalar(const HighsInt* start, const HighsInt* index,
+                               const double* value, const double* x,
+                               HighsInt from_col, HighsInt to_col,
+                               double* result) {
+  for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+    double sum = 0;
+    for (HighsInt iEl = start[iCol]; iEl < start[iCol + 1]; iEl++)
+      sum += x[index[iEl]] * value[iEl];
+    result[iCol - from_col] = sum;
+  }
+}
+
+static void scatterAddDenseScalar(const HighsInt* index, const double* value,
+                                  HighsInt from_el, HighsInt to_el,
+                                  double multiplier, double* result) {
+  for (HighsInt iEl = from_el; iEl < to_el; iEl++) {
+    HighsInt iCol = index[iEl];
+    double value1 = result[iCol] + multiplier * value[iEl];
+    result[iCol] = (std::fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+}
+
+static HighsInt scatterAddSparseScalar(const HighsInt* index,
+                                       const double* value, HighsInt from_el,
+                                       HighsInt to_el, double multiplier,
+                                       double* result, HighsInt* result_index,
+                                       HighsInt result_count) {
+  for (HighsInt iEl = from_el; iEl < to_el; iEl++) {
+    HighsInt iCol = index[iEl];
+    double value0 = result[iCol];
+    double value1 = value0 + multiplier * value[iEl];
+    if (value0 == 0) result_index[result_count++] = iCol;
+    result[iCol] = (std::fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+  return result_count;
+}
+
+static void updateEdgeWeightsScalar(const HighsInt* index, HighsInt from_k,
+                                    HighsInt to_k, const double* column,
+                                    const double* dse, double pivotal_weight,
+                                    double kai, double min_weight,
+                                    double* weight) {
+  for (HighsInt k = from_k; k < to_k; k++) {
+    const HighsInt i = index ? index[k] : k;
+    const double a = column[i];
+    if (!a) continue;
+    weight[i] += a * (pivotal_weight * a + kai * dse[i]);
+    weight[i] = std::max(min_weight, weight[i]);
+  }
+}
+
+#ifdef HIGHS_SIMD_KERNELS
+// This file is compiled with -ffp-contract=off, so that each product
+// is rounded before it is added, as in the scalar loops, even where the
+// target attribute implies FMA
+
+__attribute__((target("avx2"))) static void priceColumnsAvx2(
+    const HighsInt* start, const HighsInt* index, const double* value,
+    const double* x, HighsInt from_col, HighsInt to_col, double* result) {
+  const __m128i one = _mm_set1_epi32(1);
+  HighsInt iCol = from_col;
+  for (; iCol + 4 <= to_col; iCol += 4) {
+    HighsInt max_len = 0;
+    for (HighsInt k = 0; k < 4; k++)
+      max_len = std::max(max_len, start[iCol + k + 1] - start[iCol + k]);
+    __m128i pos = _mm_loadu_si128((const __m128i*)(start + iCol));
+    const __m128i end = _mm_loadu_si128((const __m128i*)(start + iCol + 1));
+    __m256d sum = _mm256_setzero_pd();
+    for (HighsInt t = 0; t < max_len; t++) {
+      const __m128i active = _mm_cmpgt_epi32(end, pos);
+      const __m256d active_pd =
+          _mm256_castsi256_pd(_mm256_cvtepi32_epi64(active));
+      const __m128i idx =
+          _mm_mask_i32gather_epi32(_mm_setzero_si128(), index, pos, active, 4);
+      const __m256d a = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), value,
+                                                 pos, active_pd, 8);
+      const __m256d xv = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, idx,
+                                                  active_pd, 8);
+      sum = _mm256_blendv_pd(sum, _mm256_add_pd(sum, _mm256_mul_pd(xv, a)),
+                             active_pd);
+      pos = _mm_add_epi32(pos, one);
+    }
+    _mm256_storeu_pd(result + (iCol - from_col), sum);
+  }
+  priceColumnsScalar(start, index, value, x, iCol, to_col,
+                     result + (iCol - from_col));
+}
+
+__attribute__((target("avx2"))) static HighsInt scatterAddAvx2(
+    const HighsInt* index, const double* value, HighsInt from_el,
+    HighsInt to_el, double multiplier, double* result, HighsInt* result_index,
+    HighsInt result_count, bool sparse) {
+  const __m256d mult = _mm256_set1_pd(multiplier);
+  const __m256d tiny = _mm256_set1_pd(kHighsTiny);
+  const __m256d zero = _mm256_set1_pd(kHighsZero);
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffff));
+  const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  HighsInt iEl = from_el;
+  for (; iEl + 4 <= to_el; iEl += 4) {
+    const __m128i idx = _mm_loadu_si128((const __m128i*)(index + iEl));
+    const __m256d value0 =
+        _mm256_mask_i32gather_pd(_mm256_setzero_pd(), result, idx, all, 8);
+    const __m256d product = _mm256_mul_pd(mult, _mm256_loadu_pd(value + iEl));
+    __m256d value1 = _mm256_add_pd(value0, product);
+    const __m256d small =
+        _mm256_cmp_pd(_mm256_and_pd(value1, abs_mask), tiny, _CMP_LT_OQ);
+    value1 = _mm256_blendv_pd(value1, zero, small);
+    if (sparse) {
+      int was_zero = _mm256_movemask_pd(
+          _mm256_cmp_pd(value0, _mm256_setzero_pd(), _CMP_EQ_OQ));
+      for (HighsInt k = 0; was_zero; k++, was_zero >>= 1)
+        if (was_zero & 1) result_index[result_count++] = index[iEl + k];
+    }
+    // AVX2 has no scatter, but the indices of a row are distinct
+    alignas(32) double out[4];
+    _mm256_store_pd(out, value1);
+    for (HighsInt k = 0; k < 4; k++) result[index[iEl + k]] = out[k];
+  }
+  if (sparse)
+    return scatterAddSparseScalar(index, value, iEl, to_el, multiplier, result,
+                                  result_index, result_count);
+  scatterAddDenseScalar(index, value, iEl, to_el, multiplier, result);
+  return result_count;
+}
+
+// The weights of entries with zero column value are blended back
+// unchanged. std::max(min_weight, w) is w only if min_weight < w, as is
+// _mm256_max_pd(w, min_weight)
+__attribute__((target("avx2"))) static void updateEdgeWeightsAvx2(
+    const HighsInt* index, HighsInt count, const double* column,
+    const double* dse, double pivotal_weight, double kai, double min_weight,
+    double* weight) {
+  const __m256d pivotal = _mm256_set1_pd(pivotal_weight);
+  const __m256d kai_v = _mm256_set1_pd(kai);
+  const __m256d min_v = _mm256_set1_pd(min_weight);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  HighsInt k = 0;
+  for (; k + 4 <= count; k += 4) {
+    __m256d a, d, w;
+    __m128i idx;
+    if (index) {
+      idx = _mm_loadu_si128((const __m128i*)(index + k));
+      a = _mm256_mask_i32gather_pd(zero, column, idx, all, 8);
+    } else {
+      a = _mm256_loadu_pd(column + k);
+    }
+    const __m256d nonzero = _mm256_cmp_pd(a, zero, _CMP_NEQ_UQ);
+    if (_mm256_movemask_pd(nonzero) == 0) continue;
+    if (index) {
+      d = _mm256_mask_i32gather_pd(zero, dse, idx, all, 8);
+      w = _mm256_mask_i32gather_pd(zero, weight, idx, all, 8);
+    } else {
+      d = _mm256_loadu_pd(dse + k);
+      w = _mm256_loadu_pd(weight + k);
+    }
+    const __m256d change = _mm256_mul_pd(
+        a, _mm256_add_pd(_mm256_mul_pd(pivotal, a), _mm256_mul_pd(kai_v, d)));
+    const __m256d new_w = _mm256_max_pd(_mm256_add_pd(w, change), min_v);
+    w = _mm256_blendv_pd(w, new_w, nonzero);
+    if (index) {
+      alignas(32) double out[4];
+      _mm256_store_pd(out, w);
+      for (HighsInt j = 0; j < 4; j++) weight[index[k + j]] = out[j];
+    } else {
+      _mm256_storeu_pd(weight + k, w);
+    }
+  }
+  updateEdgeWeightsScalar(index, k, count, column, dse, pivotal_weight, kai,
+                          min_weight, weight);
+}
+
+__attribute__((target("avx512f,avx2"))) static void updateEdgeWeightsAvx512(
+    const HighsInt* index, HighsInt count, const double* column,
+    const double* dse, double pivotal_weight, double kai, double min_weight,
+    double* weight) {
+  const __m512d pivotal = _mm512_set1_pd(pivotal_weight);
+  const __m512d kai_v = _mm512_set1_pd(kai);
+  const __m512d min_v = _mm512_set1_pd(min_weight);
+  const __m512d zero = _mm512_setzero_pd();
+  HighsInt k = 0;
+  for (; k + 8 <= count; k += 8) {
+    __m512d a, d, w;
+    __m256i idx;
+    if (index) {
+      idx = _mm256_loadu_si256((const __m256i*)(index + k));
+      a = _mm512_mask_i32gather_pd(zero, 0xff, idx, column, 8);
+    } else {
+      a = _mm512_loadu_pd(column + k);
+    }
+    const __mmask8 nonzero = _mm512_cmp_pd_mask(a, zero, _CMP_NEQ_UQ);
+    if (!nonzero) continue;
+    if (index) {
+      d = _mm512_mask_i32gather_pd(zero, nonzero, idx, dse, 8);
+      w = _mm512_mask_i32gather_pd(zero, nonzero, idx, weight, 8);
+    } else {
+      d = _mm512_maskz_loadu_pd(nonzero, dse + k);
+      w = _mm512_maskz_loadu_pd(nonzero, weight + k);
+    }
+    const __m512d change = _mm512_mul_pd(
+        a, _mm512_add_pd(_mm512_mul_pd(pivotal, a), _mm512_mul_pd(kai_v, d)));
+    w = _mm512_maskz_max_pd(nonzero, _mm512_add_pd(w, change), min_v);
+    // The indices of a column are distinct, so the scatter has no
+    // conflicts
+    if (index) {
+      _mm512_mask_i32scatter_pd(weight, nonzero, idx, w, 8);
+    } else {
+      _mm512_mask_storeu_pd(weight + k, nonzero, w);
+    }
+  }
+  updateEdgeWeightsScalar(index, k, count, column, dse, pivotal_weight, kai,
+                          min_weight, weight);
+}
+
+__attribute__((target("avx512f,avx2"))) static void priceColumnsAvx512(
+    const HighsInt* start, const HighsInt* index, const double* value,
+    const double* x, HighsInt from_col, HighsInt to_col, double* result) {
+  const __m256i one = _mm256_set1_epi32(1);
+  HighsInt iCol = from_col;
+  for (; iCol + 8 <= to_col; iCol += 8) {
+    HighsInt max_len = 0;
+    for (HighsInt k = 0; k < 8; k++)
+      max_len = std::max(max_len, start[iCol + k + 1] - start[iCol + k]);
+    __m256i pos = _mm256_loadu_si256((const __m256i*)(start + iCol));
+    const __m256i end = _mm256_loadu_si256((const __m256i*)(start + iCol + 1));
+    __m512d sum = _mm512_setzero_pd();
+    for (HighsInt t = 0; t < max_len; t++) {
+      const __m256i active = _mm256_cmpgt_epi32(end, pos);
+      const __mmask8 active_mask =
+          (__mmask8)_mm256_movemask_ps(_mm256_castsi256_ps(active));
+      const __m256i idx = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                                      index, pos, active, 4);
+      const __m512d a =
+          _mm512_mask_i32gather_pd(_mm512_setzero_pd(), active_mask, pos,
+                                   value, 8);
+      const __m512d xv = _mm512_mask_i32gather_pd(_mm512_setzero_pd(),
+                                                  active_mask, idx, x, 8);
+      sum = _mm512_mask_add_pd(sum, active_mask, sum, _mm512_mul_pd(xv, a));
+      pos = _mm256_add_epi32(pos, one);
+    }
+    _mm512_storeu_pd(result + (iCol - from_col), sum);
+  }
+  priceColumnsScalar(start, index, value, x, iCol, to_col,
+                     result + (iCol - from_col));
+}
+
+__attribute__((target("avx512f,avx2"))) static HighsInt scatterAddAvx512(
+    const HighsInt* index, const double* value, HighsInt from_el,
+    HighsInt to_el, double multiplier, double* result, HighsInt* result_index,
+    HighsInt result_count, bool sparse) {
+  const __m512d mult = _mm512_set1_pd(multiplier);
+  const __m512d tiny = _mm512_set1_pd(kHighsTiny);
+  const __m512d zero = _mm512_set1_pd(kHighsZero);
+  HighsInt iEl = from_el;
+  for (; iEl + 8 <= to_el; iEl += 8) {
+    const __m256i idx = _mm256_loadu_si256((const __m256i*)(index + iEl));
+    const __m512d value0 =
+        _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xff, idx, result, 8);
+    const __m512d product = _mm512_mul_pd(mult, _mm512_loadu_pd(value + iEl));
+    __m512d value1 = _mm512_add_pd(value0, product);
+    const __mmask8 small =
+        _mm512_cmp_pd_mask(_mm512_abs_pd(value1), tiny, _CMP_LT_OQ);
+    value1 = _mm512_mask_blend_pd(small, value1, zero);
+    if (sparse) {
+      unsigned was_zero = _mm512_cmp_pd_mask(value0, _mm512_setzero_pd(),
+                                             _CMP_EQ_OQ);
+      for (HighsInt k = 0; was_zero; k++, was_zero >>= 1)
+        if (was_zero & 1) result_index[result_count++] = index[iEl + k];
+    }
+    // the indices of a row are distinct, so the scatter has no conflicts
+    _mm512_i32scatter_pd(result, idx, value1, 8);
+  }
+  if (sparse)
+    return scatterAddSparseScalar(index, value, iEl, to_el, multiplier, result,
+                                  result_index, result_count);
+  scatterAddDenseScalar(index, value, iEl, to_el, multiplier, result);
+  return result_count;
+}
+#endif
+
+void priceColumns(const HighsInt* start, const HighsInt* index,
+                  const double* value, const double* x, HighsInt from_col,
+                  HighsInt to_col, double* result) {
+  switch (activeIsa()) {
+#ifdef HIGHS_SIMD_KERNELS
+    case Isa::kAvx512:
+      priceColumnsAvx512(start, index, value, x, from_col, to_col, result);
+      return;
+    case Isa::kAvx2:
+      priceColumnsAvx2(start, index, value, x, from_col, to_col, result);
+      return;
+#endif
+    default:
+      priceColumnsScalar(start, index, value, x, from_col, to_col, result);
+  }
+}
+
+void scatterAddDense(const HighsInt* index, const double* value,
+                     HighsInt from_el, HighsInt to_el, double multiplier,
+                     double* result) {
+  switch (activeIsa()) {
+#ifdef HIGHS_SIMD_KERNELS
+    case Isa::kAvx512:
+      scatterAddAvx512(index, value, from_el, to_el, multiplier, result,
+                       nullptr, 0, false);
+      return;
+    case Isa::kAvx2:
+      scatterAddAvx2(index, value, from_el, to_el, multiplier, result, nullptr,
+                     0, false);
+      return;
+#endif
+    default:
+      scatterAddDenseScalar(index, value, from_el, to_el, multiplier, result);
+  }
+}
+
+HighsInt scatterAddSparse(const HighsInt* index, const double* value,
+                          HighsInt from_el, HighsInt to_el, double multiplier,
+                          double* result, HighsInt* result_index,
+                          HighsInt result_count) {
+  switch (activeIsa()) {
+#ifdef HIGHS_SIMD_KERNELS
+    case Isa::kAvx512:
+      return scatterAddAvx512(index, value, from_el, to_el, multiplier, result,
+                              result_index, result_count, true);
+    case Isa::kAvx2:
+      return scatterAddAvx2(index, value, from_el, to_el, multiplier, result,
+                            result_index, result_count, true);
+#endif
+    default:
+      return scatterAddSparseScalar(index, value, from_el, to_el, multiplier,
+                                    result, result_index, result_count);
+  }
+}
+
+void updateEdgeWeights(const HighsInt* index, HighsInt count,
+                       const double* column, const double* dse,
+                       double pivotal_weight, double kai, double min_weight,
+                       double* weight) {
+  switch (activeIsa()) {
+#ifdef HIGHS_SIMD_KERNELS
+    case Isa::kAvx512:
+      updateEdgeWeightsAvx512(index, count, column, dse, pivotal_weight, kai,
+                              min_weight, weight);
+      return;
+    case Isa::kAvx2:
+      updateEdgeWeightsAvx2(index, count, column, dse, pivotal_weight, kai,
+                            min_weight, weight);
+      return;
+#endif
+    default:
+      updateEdgeWeightsScalar(index, 0, count, column, dse, pivotal_weight,
+                              kai, min_weight, weight);
+  }
+}
+
+}  // namespace simd
+}  // namespace highs
@@ -0,0 +1,77 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.h
+ * @brief Run-time dispatched SIMD kernels for PRICE and edge weights
+ */
+#ifndef UTIL_HIGHS_SIMD_H_
+#define UTIL_HIGHS_SIMD_H_
+
+#include "util/HighsInt.h"
+
+namespace highs {
+namespace simd {
+
+// Instruction set extensions that the kernels below can use
+enum class Isa { kScalar = 0, kAvx2, kAvx512 };
+
+// Best instruction set extension that is compiled in and supported by
+// the processor
+Isa supportedIsa();
+
+// Instruction set extension that the kernels currently use
+Isa activeIsa();
+
+// Sets the instruction set extension used by the kernels, limited to
+// supportedIsa(). Isa::kScalar disables vectorisation
+void setActiveIsa(Isa isa);
+
+// The vectorised kernels perform the same floating point operations in
+// the same order for each entry of the result as the scalar loops, so
+// their results are bit-identical to those of Isa::kScalar.
+
+// Column-wise PRICE for the columns [from_col, to_col) of a column-wise
+// matrix: sets result[iCol - from_col] to the dot product of column
+// iCol with the dense vector x. Several columns are accumulated at
+// once, one per vector lane, with gathered loads of x.
+void priceColumns(const HighsInt* start, const HighsInt* index,
+                  const double* value, const double* x, HighsInt from_col,
+                  HighsInt to_col, double* result);
+
+// Row-wise PRICE of one row with entries [from_el, to_el): adds
+// multiplier times the row to the dense vector result, replacing
+// values below kHighsTiny in magnitude by kHighsZero
+void scatterAddDense(const HighsInt* index, const double* value,
+                     HighsInt from_el, HighsInt to_el, double multiplier,
+                     double* result);
+
+// As scatterAddDense, but also appends the indices of entries of result
+// that were zero before to result_index, in the order of the row, and
+// returns the new number of indices
+HighsInt scatterAddSparse(const HighsInt* index, const double* value,
+                          HighsInt from_el, HighsInt to_el, double multiplier,
+                          double* result, HighsInt* result_index,
+                          HighsInt result_count);
+
+// Dual steepest edge weight update with the pivotal column: for each
+// entry i of column that is nonzero, being index[0..count) or, if index
+// is null, [0, count), sets weight[i] to the larger of min_weight and
+// weight[i] + column[i] * (pivotal_weight * column[i] + kai * dse[i])
+void updateEdgeWeights(const HighsInt* index, HighsInt count,
+                       const double* column, const double* dse,
+                       double pivotal_weight, double kai, double min_weight,
+                       double* weight);
+
+}  // namespace simd
+}  // namespace highs
+
+#endif
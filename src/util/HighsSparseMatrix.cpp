@@ -21,6 +21,7 @@
 
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
+#include "util/HighsSimd.h"
 #include "util/HighsSort.h"
 #include "util/HighsSparseVectorSum.h"
 
@@ -1189,22 +1190,37 @@ void HighsSparseMatrix::priceByColumn(const bool quad_precision,
   if (debug_report >= kDebugReportAll)
     printf("\nHighsSparseMatrix::priceByColumn:\n");
   result.count = 0;
-  for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-    double value = 0;
-    if (quad_precision) {
+  if (quad_precision) {
+    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
       HighsCDouble quad_value = 0.0;
       for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
            iEl++)
         quad_value += column.array[this->index_[iEl]] * this->value_[iEl];
-      value = (double)quad_value;
-    } else {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        value += column.array[this->index_[iEl]] * this->value_[iEl];
+      double value = (double)quad_value;
+      if (fabs(value) > kHighsTiny) {
+        result.array[iCol] = value;
+        result.index[result.count++] = iCol;
+      }
     }
-    if (fabs(value) > kHighsTiny) {
-      result.array[iCol] = value;
-      result.index[result.count++] = iCol;
+    return;
+  }
+  // Form the dot products for blocks of columns with the (possibly
+  // vectorised) kernel, so that entries of result.array for columns
+  // with tiny dot products are left untouched
+  const HighsInt kBlockSize = 256;
+  double block_value[kBlockSize];
+  for (HighsInt from_col = 0; from_col < this->num_col_;
+       from_col += kBlockSize) {
+    HighsInt to_col = min(from_col + kBlockSize, this->num_col_);
+    highs::simd::priceColumns(this->start_.data(), this->index_.data(),
+                              this->value_.data(), column.array.data(),
+                              from_col, to_col, block_value);
+    for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+      double value = block_value[iCol - from_col];
+      if (fabs(value) > kHighsTiny) {
+        result.array[iCol] = value;
+        result.index[result.count++] = iCol;
+      }
     }
   }
 }
@@ -1270,14 +1286,10 @@ void HighsSparseMatrix::priceByRowWithSwitch(
             sum.add(this->index_[iEl], multiplier * this->value_[iEl]);
           }
         } else {
-          for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
-            HighsInt iCol = this->index_[iEl];
-            double value0 = result.array[iCol];
-            double value1 = value0 + multiplier * this->value_[iEl];
-            if (value0 == 0) result.index[result.count++] = iCol;
-            result.array[iCol] =
-                (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
-          }
+          result.count = highs::simd::scatterAddSparse(
+              this->index_.data(), this->value_.data(), this->start_[iRow],
+              to_iEl, multiplier, result.array.data(), result.index.data(),
+              result.count);
         }
       }
       next_index = ix + 1;
@@ -1417,12 +1429,9 @@ void HighsSparseMatrix::priceByRowDenseResult(
     }
     if (debug_report == kDebugReportAll || debug_report == iRow)
       debugReportRowPrice(iRow, multiplier, to_iEl, result);
-    for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
-      HighsInt iCol = this->index_[iEl];
-      double value0 = result[iCol];
-      double value1 = value0 + multiplier * this->value_[iEl];
-      result[iCol] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
-    }
+    highs::simd::scatterAddDense(this->index_.data(), this->value_.data(),
+                                 this->start_[iRow], to_iEl, multiplier,
+                                 result.data());
   }
 }
 